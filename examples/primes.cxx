@@ -22,49 +22,71 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <math/prime/sieve_of_eratosthenes.h>
 #include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <math/prime/count_primes.h>
+#include <math/prime/mapped_sieve.h>
+#include <math/prime/range_sieve.h>
+#include <math/prime/bucket_sieve.h>
+#include <math/prime/miller_rabin.h>
 #include <math/number.h>
-#include <generator/select.h>
+#include <types/bitset.h>
+#include <types/format.h>
 #include <performance/measurement.h>
 
 #include <boost/program_options.hpp>
+#include <functional>
 #include <string>
 #include <memory>
-#include <iomanip>
+#include <vector>
 #include <iostream>
 #include <cstdint>
 
 /// @struct options
 /// @brief parsed command line options
 struct Options {
-    /// type of filter function
-    using filter_function_type = std::function<bool (const uint64_t&)>;
+    /// type of function called for each candidate
+    using candidate_function_type = std::function<void (const uint64_t)>;
+    /// type of function enumerating the candidates of a filter in [first, last] in increasing order
+    using filter_function_type = std::function<void (const uint64_t, const uint64_t, const candidate_function_type&)>;
 
     uint64_t max_number;         ///! the biggest number that should be checked to be a prime.
     uint64_t start_number;       ///! starting output with first prime >= this number.
     uint64_t max_columns;        ///! number of columns for printing primes
-    filter_function_type filter; ///! additional filter function
+    filter_function_type filter; ///! candidates of the filter (nullptr: all primes of the sieve)
     std::string sieve;           ///! sieve algorithm
+    bool count_only;             ///! when true counting primes only (no sieve, no output of primes)
+    std::string sieve_file;      ///! file for persisting the calculated sieve (memory mapped)
 
     /// default c'tor initializing defaults
     Options()
-        : max_number(1000), start_number(2), max_columns(10), filter(nullptr), sieve("default") {}
+        : max_number(1000), start_number(2), max_columns(10), filter(nullptr), sieve("default")
+        , count_only(false), sieve_file() {}
 };
 
-/// Providing filter as configured.
+/// Providing filter as configured. The candidates of a filter are enumerated
+/// directly (no sieve is required) and tested to be prime with Miller-Rabin.
 /// @param filter_name name of the filter
-/// @return concrete filter function or true function.
+/// @return function enumerating the candidates of the filter or nullptr.
 Options::filter_function_type resolve_filter(const std::string& filter_name) noexcept {
     if (filter_name == "pandigital") {
         std::cout << " ... applying 'pandigital' filter" << std::endl;
-        return [](const uint64_t number) {return math::number<uint64_t>::is_pandigital(number);};
+        return [](const uint64_t first, const uint64_t last, const Options::candidate_function_type& function) {
+            math::digits<uint64_t>::for_each_pandigital(first, last, function);
+        };
     }
     if (filter_name == "palindrome") {
         std::cout << " ... applying 'palindrome' filter" << std::endl;
-        return [](const uint64_t number) {return math::number<uint64_t>::is_palindrome(number);};
+        return [](const uint64_t first, const uint64_t last, const Options::candidate_function_type& function) {
+            math::digits<uint64_t>::for_each_palindrome(first, last, [&function](const uint64_t number) {
+                // palindromes with an even number of digits are multiples of 11
+                if (number < 10 || number == 11 || math::digits<uint64_t>::count(number) % 2 == 1) {
+                    function(number);
+                }
+            });
+        };
     }
     std::cout << " ... no additional filter" << std::endl;
-    return [](const uint64_t) {return true;};
-} 
+    return nullptr;
+}
 
 /// @param argc number of parameters
 /// @param argv array of parameters
@@ -83,9 +105,15 @@ static bool parse(int argc, char** argv, Options& options) {
         ("columns", po::value<uint64_t>(&options.max_columns)->default_value(10),
          "number of columns (default: 10)")
         ("filter", po::value<std::string>(&filter_name)->default_value(""),
-         "providing filter name (default: none).")
+         "providing filter name: 'palindrome' or 'pandigital' (default: none; candidates are tested without a sieve).")
         ("sieve", po::value<std::string>(&options.sieve)->default_value("default"),
-         "sieve algorithm short name (default: 'default', other is 'optimized').")
+         "sieve algorithm short name (default: 'default', others are 'optimized', 'range' and 'bucket'"
+         " which sieve [start-number, max-number] only).")
+        ("count-only", po::bool_switch(&options.count_only),
+         "counting primes in [start-number, max-number] without a full sieve"
+         " (sieve 'bucket' counts segment by segment, filter is ignored).")
+        ("sieve-file", po::value<std::string>(&options.sieve_file)->default_value(""),
+         "file for the calculated sieve: mapped into memory when big enough, otherwise written (default: none).")
         ;
 
     po::variables_map vm;
@@ -112,16 +140,147 @@ static bool parse(int argc, char** argv, Options& options) {
     return true;
 }
 
-/// @return sieve algorithm depending on command line option
+/// Printing the primes in columns and the number of primes.
+/// @param width width of a column
+/// @param options the command line options (for the number of columns)
+/// @param enumerate function calling its parameter for each prime to print (increasing order)
+static void print(const std::size_t width, const Options& options,
+                  const std::function<void (const Options::candidate_function_type&)>& enumerate) {
+    auto count = static_cast<uint64_t>(0);
+    {
+        // formatted into a buffer written in big blocks (no stream formatting per prime)
+        types::output_sink sink(std::cout);
+        enumerate([&sink, &count, width, &options](const uint64_t prime) {
+            sink.write(prime, width);
+            ++count;
+            if (count % options.max_columns == 0) {
+                sink.write('\n');
+            }
+        });
+        sink.write("\n\n");
+    }
+    std::cout << " ... " << count << " primes found." << std::endl;
+}
+
+/// Printing the primes in columns and the number of primes.
+/// @param primes the primes to print
+/// @param options the command line options (for the number of columns)
+static void print(const std::vector<uint64_t>& primes, const Options& options) {
+    const auto width = primes.empty()? 1: math::digits<uint64_t>::count(primes.back()) + 1;
+    print(width, options, [&primes](const Options::candidate_function_type& function) {
+        for (const auto prime: primes) {
+            function(prime);
+        }
+    });
+}
+
+/// Calculating the sieve, writing it to the sieve file (when configured) and printing the primes.
+/// The concrete sieve type lets the primes be collected by its own word scan (no virtual call per prime).
+/// @param sieve sieve to calculate
+/// @param options command line options
+/// @param is_mapped true when the sieve has been loaded from the sieve file
+/// @return 0 when succeeded, 1 when failed
+template <typename S>
+int sieve_primes(S& sieve, const Options& options, const bool is_mapped) {
+    const auto sieve_duration = performance::measure<std::milli>([&sieve]() {
+        /// calculating the primes and none primes
+        sieve.calculate();
+    });
+
+    if (!is_mapped && !options.sieve_file.empty() && options.sieve == "range") {
+        std::cout << " ... sieve file ignored (" << options.sieve
+                  << " sieve does not cover [0, max-number])" << std::endl;
+    } else if (!is_mapped && !options.sieve_file.empty()) {
+        try {
+            math::prime::mapped_sieve<typename S::container_type>::write(options.sieve_file, sieve);
+            std::cout << " ... sieve written to file " << options.sieve_file << std::endl;
+        } catch (const std::exception& e) {
+            std::cout << "error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << " ... collecting primes" << std::endl;
+    std::cout << std::endl;
+
+    /// collecting primes scanning the sieve word by word
+    std::vector<uint64_t> primes;
+    sieve.for_each_prime(options.start_number, options.max_number,
+        [&primes](const uint64_t prime) {primes.push_back(prime);});
+
+    print(primes, options);
+    std::cout << " ... Sieve calculation took " << sieve_duration << "ms." << std::endl;
+    return 0;
+}
+
+/// Printing the primes of the window of the bucket sieve while sieving segment
+/// by segment: the window is never stored (see @ref math::prime::bucket_sieve::stream).
+/// @param sieve bucket sieve for [start-number, max-number]
+/// @param options command line options
+/// @return 0 when succeeded, 1 when failed
+template <typename T>
+int stream_primes(const math::prime::bucket_sieve<T>& sieve, const Options& options) {
+    if (!options.sieve_file.empty()) {
+        std::cout << " ... sieve file ignored (bucket sieve does not store the window)" << std::endl;
+    }
+
+    std::cout << " ... streaming primes" << std::endl;
+    std::cout << std::endl;
+
+    const auto width = math::digits<uint64_t>::count(options.max_number) + 1;
+    const auto stream_duration = performance::measure<std::milli>([&sieve, &options, width]() {
+        print(width, options, [&sieve](const Options::candidate_function_type& function) {
+            sieve.stream(function);
+        });
+    });
+
+    std::cout << " ... Sieving and printing took " << stream_duration << "ms." << std::endl;
+    return 0;
+}
+
+/// Creating the sieve algorithm depending on command line option.
+/// @return 0 when succeeded, 1 when failed
 template <typename T>
-std::unique_ptr<math::prime::sieve_interface<T>> create_sieve(const Options& options) noexcept {
+int create_sieve(const Options& options) {
+    std::cout << " ... creating sieve up to max. number: " << options.max_number << std::endl;
+
+    if (options.sieve == "range") {
+        math::prime::range_sieve<T> sieve(options.start_number, options.max_number);
+        return sieve_primes(sieve, options, false);
+    }
+
+    if (options.sieve == "bucket") {
+        const math::prime::bucket_sieve<T> sieve(options.start_number, options.max_number);
+        return stream_primes(sieve, options);
+    }
+
     if (options.sieve == "optimized") {
-        return std::unique_ptr<math::prime::sieve_interface<T>>(
-            new math::prime::sieve_of_eratosthenes_optimized<T>(options.max_number));
+        math::prime::sieve_of_eratosthenes_optimized<T> sieve(options.max_number);
+        return sieve_primes(sieve, options, false);
     }
 
-    return std::unique_ptr<math::prime::sieve_interface<T>>(
-        new math::prime::sieve_of_eratosthenes<T>(options.max_number));
+    math::prime::sieve_of_eratosthenes<T> sieve(options.max_number);
+    return sieve_primes(sieve, options, false);
+}
+
+/// @return memory mapped sieve when configured sieve file exists and is big enough otherwise nullptr
+template <typename T>
+std::unique_ptr<math::prime::mapped_sieve<T>> load_sieve(const Options& options) noexcept {
+    if (options.sieve_file.empty()) {
+        return nullptr;
+    }
+
+    try {
+        std::unique_ptr<math::prime::mapped_sieve<T>> sieve(new math::prime::mapped_sieve<T>(options.sieve_file));
+        if (sieve->max_number() >= options.max_number) {
+            std::cout << " ... using sieve file " << options.sieve_file << std::endl;
+            return sieve;
+        }
+        std::cout << " ... sieve file " << options.sieve_file << " is too small" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << " ... " << e.what() << std::endl;
+    }
+    return nullptr;
 }
 
 /// Simple example demonstrating how to generate primes.
@@ -138,37 +297,49 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    std::cout << " ... creating sieve up to max. number: " << options.max_number << std::endl;
-    /// initializing maximum 'size' of sieve
-    auto sieve = create_sieve<std::vector<bool>>(options);
+    if (options.count_only) {
+        auto count = static_cast<uint64_t>(0);
+        const auto count_duration = performance::measure<std::milli>([&options, &count]() {
+            if (options.sieve == "bucket") {
+                // sieving segment by segment counting the set bits only
+                count = math::prime::bucket_sieve<types::bitset<uint64_t>>(
+                    options.start_number, options.max_number).count();
+            } else if (options.start_number <= options.max_number) {
+                count = math::prime::count_primes(options.max_number);
+                if (options.start_number > 0) {
+                    count -= math::prime::count_primes(options.start_number - 1);
+                }
+            }
+        });
 
-    const auto sieve_duration = performance::measure<std::milli>([&sieve]() {
-        /// calculating the primes and none primes
-        sieve->calculate();
-    });
+        std::cout << " ... " << count << " primes found." << std::endl;
+        std::cout << " ... Counting took " << count_duration << "ms." << std::endl;
+        return 0;
+    }
 
-    std::cout << " ... collecting primes" << std::endl;
-    std::cout << std::endl;
+    if (options.filter) {
+        std::cout << " ... testing candidates in [" << options.start_number << ", "
+                  << options.max_number << "] (no sieve)" << std::endl;
+        std::cout << std::endl;
 
-    /// printing out all primes
-    constexpr auto step = static_cast<uint64_t>(1);
-    const auto primes = generator::select(options.start_number, options.max_number, step)
-           .where([&sieve](const int n){return sieve->is_prime(n);})
-           .where(options.filter)
-           .to_vector();
-
-    const auto width = math::digits<int>::count(*(primes.end()-1)) + 1;
-
-    auto column = static_cast<uint64_t>(0);
-    for (const auto& prime: primes) {
-        std::cout << std::setw(width) << prime;
-        ++column;
-        if (column % options.max_columns == 0) {
-            std::cout << std::endl;
-        }
+        std::vector<uint64_t> primes;
+        const auto filter_duration = performance::measure<std::milli>([&options, &primes]() {
+            options.filter(options.start_number, options.max_number, [&primes](const uint64_t candidate) {
+                if (math::prime::miller_rabin::is_prime(candidate)) {
+                    primes.push_back(candidate);
+                }
+            });
+        });
+
+        print(primes, options);
+        std::cout << " ... Testing candidates took " << filter_duration << "ms." << std::endl;
+        return 0;
     }
-    std::cout << std::endl << std::endl;
-    std::cout << " ... " << primes.size() << " primes found." << std::endl;
-    std::cout << " ... Sieve calculation took " << sieve_duration << "ms." << std::endl;
-    return 0;
+
+    const auto sieve = load_sieve<types::bitset<uint64_t>>(options);
+    if (sieve) {
+        return sieve_primes(*sieve, options, true);
+    }
+
+    return create_sieve<types::bitset<uint64_t>>(options);
 }
@@ -27,7 +27,7 @@
 
 #include <unordered_map>
 #include <iostream>
-#include <sstream>
+#include <string>
 #include <type_traits>
 #include <limits>
 #include <cstdint>
@@ -118,23 +118,17 @@ class big_integer {
 
         /// dumping big integer content to stream
         friend std::ostream& operator << (std::ostream& stream, const big_integer& bi) {
-            const auto itEnd = bi.m_digits.rend();
-            stream << "big_integer(";
-            for (auto it = bi.m_digits.rbegin(); it != itEnd; ++it) {
-                stream << static_cast<uint32_t>(*it);
-            }
-            stream << ")";
-            return stream;
+            return stream << "big_integer(" << bi.to_string() << ")";
         }
 
-        /// providing big_integer "value" as string
+        /// providing big_integer "value" as string (one character per digit, no stream)
         std::string to_string() const noexcept {
-            const auto itEnd = m_digits.rend();
-            std::stringstream stream;
-            for (auto it = m_digits.rbegin(); it != itEnd; ++it) {
-                stream << static_cast<uint32_t>(*it);
+            std::string result(m_digits.size(), '0');
+            auto position = result.begin();
+            for (auto it = m_digits.rbegin(); it != m_digits.rend(); ++it, ++position) {
+                *position = static_cast<char>('0' + *it);
             }
-            return stream.str();
+            return result;
         }
 
         /// @return number of digits in the integer
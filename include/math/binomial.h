@@ -0,0 +1,192 @@
+///
+/// @author  Thomas Lehmann
+/// @file    binomial.h
+/// @brief   binomial and multinomial coefficients by the exponents of the primes
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_BINOMIAL_H_
+#define INCLUDE_MATH_BINOMIAL_H_
+
+#include <math/big_integer.h>
+#include <math/decimal_limbs.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <types/bitset.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace math {
+
+/// @class binomial
+/// @brief exact binomial and multinomial coefficients.
+///
+/// The exponent of each prime \f$p \le n\f$ is calculated with Legendre's
+/// formula \f$v_p(n!) = \sum_{i \ge 1} \lfloor n / p^i \rfloor\f$ (no division
+/// of big numbers at all). The result is assembled bit by bit of the exponents
+/// (\f$r = r^2 \cdot P_i\f$ where \f$P_i\f$ is the product of the primes with bit i
+/// set in their exponent); each \f$P_i\f$ is a balanced product tree. All products
+/// are base 10^9 limbs (@ref detail::decimal_limbs with Karatsuba), converted to a
+/// @ref big_integer at the end.
+///
+/// @code
+/// math::binomial::coefficient(50, 25).to_string();        // "126410606437752"
+/// math::binomial::multinomial({2, 3, 4}).to_string();    // "1260" (9! / (2! 3! 4!))
+/// @endcode
+class binomial final {
+    public:
+        /// pairs of prime and exponent (increasing primes, no zero exponents)
+        using factors_type = std::vector<std::pair<uint64_t, uint64_t>>;
+        /// base 10^9 digits
+        using limbs_type = detail::decimal_limbs::limbs_type;
+
+        /// @return exponent of given prime in \f$n!\f$ (Legendre's formula)
+        inline static uint64_t factorial_exponent(const uint64_t n, const uint64_t prime) noexcept {
+            auto result = uint64_t(0);
+            for (auto rest = n / prime; rest > 0; rest /= prime) {
+                result += rest;
+            }
+            return result;
+        }
+
+        /// @return prime factorization of \f$\binom{n}{k}\f$
+        /// @throw std::runtime_error when k > n (the coefficient is 0)
+        inline static factors_type factors(const uint64_t n, const uint64_t k) {
+            if (k > n) {
+                throw std::runtime_error("binomial coefficient is 0 for k > n");
+            }
+            return multinomial_factors({k, n - k});
+        }
+
+        /// @param parts the numbers \f$k_1, k_2, ...\f$ with \f$n = \sum k_i\f$
+        /// @return prime factorization of \f$\frac{n!}{k_1! \cdot k_2! \cdots}\f$
+        /// @throw std::overflow_error when the sum of the parts does not fit into 64 bit
+        inline static factors_type multinomial_factors(const std::vector<uint64_t>& parts) {
+            auto n = uint64_t(0);
+            for (const auto part: parts) {
+                if (n + part < n) {
+                    throw std::overflow_error("sum of the multinomial parts does not fit into 64 bit");
+                }
+                n += part;
+            }
+
+            factors_type result;
+            if (n < 2) {
+                return result;
+            }
+
+            prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(n);
+            sieve.calculate();
+            sieve.for_each_prime(2, n, [n, &parts, &result](const uint64_t prime) {
+                auto exponent = factorial_exponent(n, prime);
+                for (const auto part: parts) {
+                    exponent -= factorial_exponent(part, prime);
+                }
+                if (exponent > 0) {
+                    result.emplace_back(prime, exponent);
+                }
+            });
+            return result;
+        }
+
+        /// @return \f$\binom{n}{k}\f$ (0 when k > n)
+        inline static big_integer coefficient(const uint64_t n, const uint64_t k) {
+            if (k > n) {
+                return big_integer(0);
+            }
+            return detail::decimal_limbs::to_big_integer(product(factors(n, k)));
+        }
+
+        /// @param parts the numbers \f$k_1, k_2, ...\f$ with \f$n = \sum k_i\f$
+        /// @return \f$\frac{n!}{k_1! \cdot k_2! \cdots}\f$
+        inline static big_integer multinomial(const std::vector<uint64_t>& parts) {
+            return detail::decimal_limbs::to_big_integer(product(multinomial_factors(parts)));
+        }
+
+        /// @param factors pairs of prime and exponent
+        /// @return product of the prime powers
+        inline static limbs_type product(const factors_type& factors) {
+            auto max_exponent = uint64_t(0);
+            for (const auto& factor: factors) {
+                max_exponent = std::max(max_exponent, factor.second);
+            }
+
+            auto bit = 0;
+            while (bit < 64 && (max_exponent >> bit) > 1) {
+                ++bit;
+            }
+
+            limbs_type result(1, 1);
+            for (; bit >= 0 && max_exponent > 0; --bit) {
+                result = detail::decimal_limbs::multiply(result, result);
+
+                // product of the primes with given bit in their exponent
+                std::vector<limbs_type> values;
+                auto packed = uint64_t(1);
+                for (const auto& factor: factors) {
+                    if (((factor.second >> bit) & 1) == 0) {
+                        continue;
+                    }
+                    if (factor.first >= detail::decimal_limbs::BASE / packed) {
+                        values.push_back(detail::decimal_limbs::from_u64(packed));
+                        packed = 1;
+                    }
+                    if (factor.first >= detail::decimal_limbs::BASE) {
+                        values.push_back(detail::decimal_limbs::from_u64(factor.first));
+                    } else {
+                        packed *= factor.first;
+                    }
+                }
+                values.push_back(detail::decimal_limbs::from_u64(packed));
+                result = detail::decimal_limbs::multiply(result, product_tree(values));
+            }
+            return result;
+        }
+
+    private:
+        /// disable c'tor
+        binomial() = delete;
+
+        /// @param values the factors (modified: used as work space)
+        /// @return product of the values multiplying neighbours level by level
+        ///         (factors of similar size for Karatsuba)
+        inline static limbs_type product_tree(std::vector<limbs_type>& values) {
+            if (values.empty()) {
+                return limbs_type(1, 1);
+            }
+
+            while (values.size() > 1) {
+                auto count = std::size_t(0);
+                for (auto index = std::size_t(0); index + 1 < values.size(); index += 2) {
+                    values[count++] = detail::decimal_limbs::multiply(values[index], values[index + 1]);
+                }
+                if (values.size() % 2 == 1) {
+                    values[count++] = std::move(values.back());
+                }
+                values.resize(count);
+            }
+            return values.front();
+        }
+};
+
+}  // namespace math
+
+#endif  // INCLUDE_MATH_BINOMIAL_H_
@@ -23,12 +23,197 @@
 #ifndef INCLUDE_CONSTANTS_H_
 #define INCLUDE_CONSTANTS_H_
 
+#include <math/big_integer.h>
+#include <math/decimal_limbs.h>
 #include <boost/math/constants/constants.hpp>
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
 namespace math {
 
 const double PI = boost::math::constants::pi<double>();
 
+/// @class constants
+/// @brief constants to any count of decimal digits.
+///
+/// The series are summed up as one exact fraction by binary splitting: the
+/// terms of a range are combined from the fractions of both halves so the
+/// big multiplications are working on factors of similar size (Karatsuba
+/// of @ref detail::decimal_limbs). One division and - for pi - one square root
+/// (both Newton's iteration) are finishing the calculation.
+///
+/// The results are the constants multiplied by 10^digits and rounded down;
+/// they are calculated with nine more digits and truncated (a wrong last
+/// digit would need nine nines or zeros in a row after it).
+///
+/// @code
+/// math::constants::pi(10).to_string();         // 31415926535
+/// math::constants::e(10).to_string();          // 27182818284
+/// math::constants::sqrt(2, 10).to_string();    // 14142135623
+/// @endcode
+class constants final {
+    public:
+        /// base 10^9 digits (least significant first)
+        using limbs_type = detail::decimal_limbs::limbs_type;
+
+        /// 640320^3 / 24 (Chudnovsky)
+        enum : uint64_t {C3_OVER_24 = 10939058860032000ULL};
+        /// decimal digits per term of the Chudnovsky series (log10(640320^3 / 1728) = 14.18...)
+        enum {DIGITS_PER_TERM = 14};
+
+        /// no instances
+        constants() = delete;
+
+        /// Chudnovsky: \f$\frac{1}{\pi} = 12 \sum_{k=0}^{\infty}
+        /// \frac{(-1)^k (6k)! (13591409 + 545140134 k)}{(3k)! (k!)^3 640320^{3k + 3/2}}\f$
+        /// giving \f$\pi = \frac{426880 \sqrt{10005} Q}{T}\f$ for the binary splitting.
+        /// @param digits number of decimal digits after the point
+        /// @return pi * 10^digits rounded down
+        inline static big_integer pi(const std::size_t digits) {
+            const auto scale = digits + detail::decimal_limbs::DIGITS_PER_LIMB;
+            const auto terms = scale / DIGITS_PER_TERM + 2;
+            auto sum = chudnovsky(0, terms, false);
+
+            // Q and T are having more digits than required: the same count of low limbs is dropped of both
+            const auto limbs = scale / detail::decimal_limbs::DIGITS_PER_LIMB + 3;
+            if (sum.t.size() > limbs) {
+                const auto dropped = static_cast<std::ptrdiff_t>(sum.t.size() - limbs);
+                sum.t.erase(sum.t.begin(), sum.t.begin() + dropped);
+                sum.q.erase(sum.q.begin(), sum.q.begin() + dropped);
+            }
+
+            // sqrt(10005) * 10^scale
+            const auto root = detail::decimal_limbs::square_root(shift(detail::decimal_limbs::from_u64(10005),
+                                                                       2 * scale));
+            const auto numerator = detail::decimal_limbs::multiply(detail::decimal_limbs::multiply(root, sum.q),
+                                                                   detail::decimal_limbs::from_u64(426880));
+            return truncate(detail::decimal_limbs::divide(numerator, sum.t));
+        }
+
+        /// \f$e = \sum_{k=0}^{\infty} \frac{1}{k!} = 1 + \frac{P}{Q}\f$ with binary splitting.
+        /// @param digits number of decimal digits after the point
+        /// @return e * 10^digits rounded down
+        inline static big_integer e(const std::size_t digits) {
+            const auto scale = digits + detail::decimal_limbs::DIGITS_PER_LIMB;
+            // terms! > 10^(scale + 2) for the remainder of the series
+            auto terms = uint64_t(1);
+            auto magnitude = 0.0;
+            while (magnitude <= static_cast<double>(scale + 2)) {
+                magnitude += std::log10(static_cast<double>(++terms));
+            }
+
+            const auto sum = euler(0, terms);
+            const auto numerator = shift(detail::decimal_limbs::add(sum.q, sum.p), scale);
+            return truncate(detail::decimal_limbs::divide(numerator, sum.q));
+        }
+
+        /// @param value value for which to calculate the square root
+        /// @param digits number of decimal digits after the point
+        /// @return sqrt(value) * 10^digits rounded down (exact)
+        inline static big_integer sqrt(const uint64_t value, const std::size_t digits) {
+            return detail::decimal_limbs::to_big_integer(
+                detail::decimal_limbs::square_root(shift(detail::decimal_limbs::from_u64(value), 2 * digits)));
+        }
+
+    private:
+        /// fraction of a range of terms (the sign belongs to t)
+        struct split_type {
+            /// product of the p(k) terms (Chudnovsky) or numerator of the partial sum (e)
+            limbs_type p;
+            /// product of the q(k) terms
+            limbs_type q;
+            /// partial sum scaled by q (Chudnovsky only)
+            limbs_type t;
+            /// true when the partial sum t is negative
+            bool negative;
+        };
+
+        /// @param first first term of the range
+        /// @param last last term of the range (excluding)
+        /// @param with_p false when p is not required (the rightmost ranges)
+        /// @return P, Q and T of the Chudnovsky series for given range of terms
+        inline static split_type chudnovsky(const uint64_t first, const uint64_t last, const bool with_p) {
+            if (last - first == 1) {
+                if (first == 0) {
+                    return split_type{{1}, {1}, {13591409}, false};
+                }
+
+                // P = (6a - 5)(2a - 1)(6a - 1), Q = a^3 * 640320^3 / 24, T = P * (13591409 + 545140134 a)
+                const auto a = first;
+                auto p = detail::decimal_limbs::multiply(detail::decimal_limbs::from_u64((6 * a - 5) * (2 * a - 1)),
+                                                         detail::decimal_limbs::from_u64(6 * a - 1));
+                auto q = detail::decimal_limbs::multiply(
+                    detail::decimal_limbs::multiply(detail::decimal_limbs::from_u64(a * a),
+                                                    detail::decimal_limbs::from_u64(a)),
+                    detail::decimal_limbs::from_u64(C3_OVER_24));
+                auto t = detail::decimal_limbs::multiply(p, detail::decimal_limbs::from_u64(13591409 + 545140134 * a));
+                return split_type{std::move(p), std::move(q), std::move(t), a % 2 == 1};
+            }
+
+            const auto middle = first + (last - first) / 2;
+            const auto left = chudnovsky(first, middle, true);
+            const auto right = chudnovsky(middle, last, with_p);
+
+            // T = T(first, middle) * Q(middle, last) + P(first, middle) * T(middle, last)
+            split_type result{with_p? detail::decimal_limbs::multiply(left.p, right.p): limbs_type(),
+                              detail::decimal_limbs::multiply(left.q, right.q),
+                              detail::decimal_limbs::multiply(left.t, right.q), left.negative};
+            const auto other = detail::decimal_limbs::multiply(left.p, right.t);
+            if (left.negative == right.negative) {
+                detail::decimal_limbs::add_in_place(result.t, other);
+            } else if (detail::decimal_limbs::compare(result.t, other) >= 0) {
+                detail::decimal_limbs::subtract_in_place(result.t, other);
+            } else {
+                result.t = detail::decimal_limbs::subtract(other, result.t);
+                result.negative = right.negative;
+            }
+            return result;
+        }
+
+        /// @param first first term of the range
+        /// @param last last term of the range (excluding)
+        /// @return P and Q with \f$\frac{P}{Q} = \sum_{k=first+1}^{last} \frac{first!}{k!}\f$
+        inline static split_type euler(const uint64_t first, const uint64_t last) {
+            if (last - first == 1) {
+                return split_type{{1}, detail::decimal_limbs::from_u64(last), {}, false};
+            }
+
+            const auto middle = first + (last - first) / 2;
+            const auto left = euler(first, middle);
+            const auto right = euler(middle, last);
+
+            // P = P(first, middle) * Q(middle, last) + P(middle, last), Q = Q(first, middle) * Q(middle, last)
+            auto p = detail::decimal_limbs::multiply(left.p, right.q);
+            detail::decimal_limbs::add_in_place(p, right.p);
+            return split_type{std::move(p), detail::decimal_limbs::multiply(left.q, right.q), {}, false};
+        }
+
+        /// @return value * 10^digits
+        inline static limbs_type shift(limbs_type value, const std::size_t digits) {
+            if (value.empty()) {
+                return value;
+            }
+
+            auto factor = uint32_t(1);
+            for (auto digit = std::size_t(0); digit < digits % detail::decimal_limbs::DIGITS_PER_LIMB; ++digit) {
+                factor *= 10;
+            }
+            value = detail::decimal_limbs::multiply(value, {factor});
+            value.insert(value.begin(), digits / detail::decimal_limbs::DIGITS_PER_LIMB, 0);
+            return value;
+        }
+
+        /// @return big integer for given value removing the nine guard digits
+        inline static big_integer truncate(limbs_type value) {
+            if (!value.empty()) {
+                value.erase(value.begin());
+            }
+            return detail::decimal_limbs::to_big_integer(value);
+        }
+};
+
 }  // namespace math
 
 #endif  // INCLUDE_CONTANTS_H_
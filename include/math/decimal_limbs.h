@@ -0,0 +1,698 @@
+///
+/// @author  Thomas Lehmann
+/// @file    decimal_limbs.h
+/// @brief   arithmetic on base 10^9 digits for big decimal numbers
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_DECIMAL_LIMBS_H_
+#define INCLUDE_MATH_DECIMAL_LIMBS_H_
+
+#include <math/big_integer.h>
+#include <types/bit_operations.h>
+#include <types/format.h>
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace math {
+namespace detail {
+
+/// @class decimal_limbs
+/// @brief arithmetic on natural numbers stored as base 10^9 digits (implementation detail).
+///
+/// Algorithms needing fast exact arithmetic calculate on these limbs and convert
+/// their result to @ref math::big_integer once: big_integer keeps one decimal digit
+/// per byte and gets its sum and product from the factory (@ref math::big_integer_configurator)
+/// which is no base for Karatsuba or Newton's iteration.
+///
+/// Nine decimal digits per 32 bit limb keep the conversion to decimal
+/// output (and to @ref math::big_integer) linear while additions and
+/// multiplications are working on nine digits at once. Products of big
+/// factors are calculated with Karatsuba; divisions and square roots are
+/// using Newton's iteration (multiplications only) doubling the precision
+/// step by step.
+///
+/// @code
+/// const auto value = math::detail::decimal_limbs::multiply({123456789, 1}, {2});   // 2 * 1123456789
+/// math::detail::decimal_limbs::write(std::cout, value);                           // 2246913578
+/// @endcode
+class decimal_limbs final {
+    public:
+        /// base 10^9 digits (least significant first, no leading zeros, empty for zero)
+        using limbs_type = std::vector<uint32_t>;
+
+        /// base of the limbs
+        enum {BASE = 1000000000};
+        /// decimal digits per limb
+        enum {DIGITS_PER_LIMB = 9};
+        /// limbs of the smaller factor below which the school method is faster than Karatsuba
+        enum {KARATSUBA_THRESHOLD = 64};
+        /// biggest exponent e with 2^e * BASE fitting into 64 bit
+        enum {MAX_SHIFT = 29};
+        /// characters written to the stream at once
+        enum {WRITE_BUFFER_SIZE = 512};
+
+        /// no instances
+        decimal_limbs() = delete;
+
+        /// removing leading zero limbs
+        inline static void trim(limbs_type& value) noexcept {
+            while (!value.empty() && value.back() == 0) {
+                value.pop_back();
+            }
+        }
+
+        /// value = value + other * BASE^shift
+        inline static void add_in_place(limbs_type& value, const limbs_type& other, const std::size_t shift = 0) {
+            if (value.size() < other.size() + shift) {
+                value.resize(other.size() + shift, 0);
+            }
+
+            auto carry = uint32_t(0);
+            auto index = shift;
+            for (const auto limb: other) {
+                const auto sum = value[index] + limb + carry;
+                carry = sum >= BASE? 1: 0;
+                value[index++] = sum - carry * BASE;
+            }
+
+            for (; carry != 0 && index < value.size(); ++index) {
+                const auto sum = value[index] + carry;
+                carry = sum >= BASE? 1: 0;
+                value[index] = sum - carry * BASE;
+            }
+
+            if (carry != 0) {
+                value.push_back(carry);
+            }
+        }
+
+        /// @return lhs + rhs
+        inline static limbs_type add(const limbs_type& lhs, const limbs_type& rhs) {
+            auto result = lhs;
+            add_in_place(result, rhs);
+            return result;
+        }
+
+        /// value = value - other (value >= other)
+        inline static void subtract_in_place(limbs_type& value, const limbs_type& other) noexcept {
+            auto borrow = uint32_t(0);
+            for (auto index = std::size_t(0); index < value.size() && (index < other.size() || borrow != 0); ++index) {
+                const auto subtrahend = (index < other.size()? other[index]: 0) + borrow;
+                borrow = value[index] < subtrahend? 1: 0;
+                value[index] = value[index] + borrow * BASE - subtrahend;
+            }
+            trim(value);
+        }
+
+        /// @return lhs - rhs (lhs >= rhs)
+        inline static limbs_type subtract(const limbs_type& lhs, const limbs_type& rhs) {
+            auto result = lhs;
+            subtract_in_place(result, rhs);
+            return result;
+        }
+
+        /// @return lhs * rhs (Karatsuba for big factors)
+        inline static limbs_type multiply(const limbs_type& lhs, const limbs_type& rhs) {
+            if (lhs.empty() || rhs.empty()) {
+                return limbs_type();
+            }
+
+            if (std::min(lhs.size(), rhs.size()) < KARATSUBA_THRESHOLD) {
+                return multiply_school(lhs, rhs);
+            }
+
+            // lhs = a1 * BASE^half + a0, rhs = b1 * BASE^half + b0
+            const auto half = std::max(lhs.size(), rhs.size()) / 2;
+            const auto low = [half](const limbs_type& value) {
+                const auto size = static_cast<std::ptrdiff_t>(std::min(half, value.size()));
+                limbs_type part(value.begin(), value.begin() + size);
+                trim(part);
+                return part;
+            };
+            const auto high = [half](const limbs_type& value) {
+                return value.size() > half
+                    ? limbs_type(value.begin() + static_cast<std::ptrdiff_t>(half), value.end()): limbs_type();
+            };
+
+            const auto a0 = low(lhs);
+            const auto a1 = high(lhs);
+            const auto b0 = low(rhs);
+            const auto b1 = high(rhs);
+
+            const auto z0 = multiply(a0, b0);
+            const auto z2 = multiply(a1, b1);
+            // (a0 + a1) * (b0 + b1) - z0 - z2 = a0 * b1 + a1 * b0
+            auto z1 = multiply(add(a0, a1), add(b0, b1));
+            subtract_in_place(z1, z0);
+            subtract_in_place(z1, z2);
+
+            auto result = z0;
+            add_in_place(result, z1, half);
+            add_in_place(result, z2, 2 * half);
+            trim(result);
+            return result;
+        }
+
+        /// @return lhs * rhs (product scanning: one carry handling per result limb)
+        inline static limbs_type multiply_school(const limbs_type& lhs, const limbs_type& rhs) {
+            limbs_type result(lhs.size() + rhs.size(), 0);
+            wide_type sum = 0;
+            for (auto position = std::size_t(0); position + 1 < result.size(); ++position) {
+                const auto first = position < rhs.size()? 0: position - rhs.size() + 1;
+                const auto last = std::min(position, lhs.size() - 1);
+                for (auto index = first; index <= last; ++index) {
+                    sum += static_cast<uint64_t>(lhs[index]) * rhs[position - index];
+                }
+                result[position] = static_cast<uint32_t>(sum % BASE);
+                sum /= BASE;
+            }
+            result.back() = static_cast<uint32_t>(sum);
+            trim(result);
+            return result;
+        }
+
+        /// @return lhs / rhs rounded down
+        /// @throw std::runtime_error when rhs is zero
+        inline static limbs_type divide(const limbs_type& lhs, const limbs_type& rhs) {
+            if (rhs.empty()) {
+                throw std::runtime_error("division by zero");
+            }
+
+            if (compare(lhs, rhs) < 0) {
+                return limbs_type();
+            }
+
+            if (rhs.size() == 1) {
+                auto result = lhs;
+                divide_in_place(result, rhs[0]);
+                return result;
+            }
+
+            if (lhs.size() - rhs.size() < KARATSUBA_THRESHOLD || rhs.size() < KARATSUBA_THRESHOLD) {
+                limbs_type quotient;
+                limbs_type rest;
+                long_division(lhs, rhs, quotient, rest);
+                return quotient;
+            }
+
+            // quotient = lhs * Y / BASE^scale with Y = BASE^scale / rhs being one or two units too small at most
+            const auto size = lhs.size() - rhs.size() + 3;
+            const auto scale = size + rhs.size() - 1;
+            auto quotient = multiply(lhs, reciprocal(rhs, size));
+            quotient.erase(quotient.begin(),
+                           quotient.begin() + static_cast<std::ptrdiff_t>(std::min(quotient.size(), scale)));
+
+            const limbs_type one(1, 1);
+            auto product = multiply(quotient, rhs);
+            while (compare(product, lhs) > 0) {
+                subtract_in_place(quotient, one);
+                subtract_in_place(product, rhs);
+            }
+            auto rest = subtract(lhs, product);
+            while (compare(rest, rhs) >= 0) {
+                add_in_place(quotient, one);
+                subtract_in_place(rest, rhs);
+            }
+            return quotient;
+        }
+
+        /// Biggest r with \f$r^2 \le value\f$. The reciprocal square root
+        /// \f$y = 1/\sqrt{value}\f$ is calculated with Newton's iteration
+        /// \f$y' = y \cdot (3 - value \cdot y^2) / 2\f$; the root is
+        /// \f$value \cdot y\f$ corrected by one at most.
+        /// @return integer square root of given value
+        inline static limbs_type square_root(const limbs_type& value) {
+            if (value.size() <= 2) {
+                const auto small = value.empty()? uint64_t(0)
+                                 : (value.size() == 2? uint64_t(value[1]) * BASE: 0) + value[0];
+                // the root of the double is off by one at most (below 10^18)
+                auto root = static_cast<uint64_t>(std::sqrt(static_cast<double>(small)));
+                while (root * root > small) {
+                    --root;
+                }
+                while ((root + 1) * (root + 1) <= small) {
+                    ++root;
+                }
+                return from_u64(root);
+            }
+
+            const auto scale = value.size() + 2;
+            auto root = multiply(value, reciprocal_square_root(value, scale));
+            root.erase(root.begin(), root.begin() + static_cast<std::ptrdiff_t>(std::min(root.size(), scale)));
+
+            // (root - 1)^2 = root^2 - (2 root - 1) and (root + 1)^2 = root^2 + (2 root + 1)
+            const limbs_type one(1, 1);
+            auto square = multiply(root, root);
+            while (compare(square, value) > 0) {
+                subtract_in_place(square, subtract(add(root, root), one));
+                subtract_in_place(root, one);
+            }
+            auto rest = subtract(value, square);
+            for (auto step = add(add(root, root), one); compare(rest, step) >= 0; step = add(add(root, root), one)) {
+                subtract_in_place(rest, step);
+                add_in_place(root, one);
+            }
+            return root;
+        }
+
+        /// Lehmer's gcd: the steps of Euclid are calculated with the leading two
+        /// limbs as long as the quotients are the same as for the full values and
+        /// applied to the full values at once (about one limb per pass). Values
+        /// of very different size are reduced by a remainder and the last 64 bit
+        /// are finished with the binary gcd (Stein).
+        /// @return greatest common divisor of given values (the other value when one is 0)
+        inline static limbs_type gcd(limbs_type lhs, limbs_type rhs) {
+            if (compare(lhs, rhs) < 0) {
+                lhs.swap(rhs);
+            }
+
+            // lhs >= rhs
+            while (rhs.size() > 2) {
+                if (lhs.size() > rhs.size() + 1) {
+                    auto rest = remainder(lhs, rhs);
+                    lhs.swap(rhs);
+                    rhs.swap(rest);
+                    continue;
+                }
+
+                // lhs = x * BASE^(n - 2) + ..., rhs = y * BASE^(n - 2) + ...
+                const auto size = lhs.size();
+                auto x = static_cast<int64_t>(lhs[size - 1]) * BASE + lhs[size - 2];
+                auto y = (rhs.size() == size? static_cast<int64_t>(rhs[size - 1]) * BASE: 0) + rhs[size - 2];
+                auto a = int64_t(1), b = int64_t(0), c = int64_t(0), d = int64_t(1);
+                while (y + c > 0 && y + d > 0) {
+                    // the quotient of the full values is in between (Knuth, algorithm L)
+                    const auto quotient = (x + a) / (y + c);
+                    if (quotient != (x + b) / (y + d) || quotient >= BASE) {
+                        break;
+                    }
+                    const auto next_c = a - quotient * c;
+                    const auto next_d = b - quotient * d;
+                    if (next_c <= -BASE || next_c >= BASE || next_d <= -BASE || next_d >= BASE) {
+                        break;
+                    }
+                    a = c;
+                    b = d;
+                    c = next_c;
+                    d = next_d;
+                    const auto next_y = x - quotient * y;
+                    x = y;
+                    y = next_y;
+                }
+
+                if (b == 0) {
+                    auto rest = remainder(lhs, rhs);
+                    lhs.swap(rhs);
+                    rhs.swap(rest);
+                } else {
+                    combine(lhs, rhs, a, b, c, d);
+                    if (compare(lhs, rhs) < 0) {
+                        lhs.swap(rhs);
+                    }
+                }
+            }
+
+            if (rhs.empty()) {
+                return lhs;
+            }
+
+            const auto to_u64 = [](const limbs_type& value) {
+                return value.empty()? uint64_t(0)
+                     : (value.size() == 2? uint64_t(value[1]) * BASE: 0) + value[0];
+            };
+            auto small_lhs = to_u64(lhs.size() > 2? remainder(lhs, rhs): lhs);
+            auto small_rhs = to_u64(rhs);
+            if (small_lhs == 0) {
+                return rhs;
+            }
+
+            const auto shift = types::count_trailing_zeros(small_lhs | small_rhs);
+            small_lhs >>= types::count_trailing_zeros(small_lhs);
+            while (small_rhs != 0) {
+                small_rhs >>= types::count_trailing_zeros(small_rhs);
+                if (small_lhs > small_rhs) {
+                    std::swap(small_lhs, small_rhs);
+                }
+                small_rhs -= small_lhs;
+            }
+            return from_u64(small_lhs << shift);
+        }
+
+        /// @return -1, 0 or 1 when lhs is less than, equal to or greater than rhs
+        inline static int compare(const limbs_type& lhs, const limbs_type& rhs) noexcept {
+            if (lhs.size() != rhs.size()) {
+                return lhs.size() < rhs.size()? -1: 1;
+            }
+
+            for (auto index = lhs.size(); index > 0; --index) {
+                if (lhs[index - 1] != rhs[index - 1]) {
+                    return lhs[index - 1] < rhs[index - 1]? -1: 1;
+                }
+            }
+            return 0;
+        }
+
+        /// @return limbs for given value
+        inline static limbs_type from_u64(const uint64_t value) {
+            limbs_type result;
+            for (auto rest = value; rest > 0; rest /= BASE) {
+                result.push_back(static_cast<uint32_t>(rest % BASE));
+            }
+            return result;
+        }
+
+        /// @return limbs for given big integer
+        inline static limbs_type from_big_integer(const big_integer& value) {
+            const auto digits = value.to_string();
+            limbs_type result;
+            result.reserve(digits.size() / DIGITS_PER_LIMB + 1);
+            for (auto end = digits.size(); end > 0;) {
+                const auto begin = end > DIGITS_PER_LIMB? end - DIGITS_PER_LIMB: 0;
+                auto limb = uint32_t(0);
+                for (auto position = begin; position < end; ++position) {
+                    limb = limb * 10 + static_cast<uint32_t>(digits[position] - '0');
+                }
+                result.push_back(limb);
+                end = begin;
+            }
+            trim(result);
+            return result;
+        }
+
+        /// @return big integer for given limbs
+        inline static big_integer to_big_integer(const limbs_type& value) {
+            digits_type digits;
+            digits.reserve(value.size() * DIGITS_PER_LIMB);
+            for (auto index = std::size_t(0); index < value.size(); ++index) {
+                auto limb = value[index];
+                for (auto digit = 0; digit < DIGITS_PER_LIMB && (limb != 0 || index + 1 < value.size()); ++digit) {
+                    digits.push_back(static_cast<digit_type>(limb % 10));
+                    limb /= 10;
+                }
+            }
+            return big_integer(digits);
+        }
+
+        /// value = value * 2^exponent
+        inline static void double_in_place(limbs_type& value, uint32_t exponent) {
+            while (exponent > 0 && !value.empty()) {
+                const auto shift = std::min(exponent, static_cast<uint32_t>(MAX_SHIFT));
+                auto carry = uint64_t(0);
+                for (auto& limb: value) {
+                    const auto product = (static_cast<uint64_t>(limb) << shift) + carry;
+                    limb = static_cast<uint32_t>(product % BASE);
+                    carry = product / BASE;
+                }
+                for (; carry != 0; carry /= BASE) {
+                    value.push_back(static_cast<uint32_t>(carry % BASE));
+                }
+                exponent -= shift;
+            }
+        }
+
+        /// value = value / 2^exponent (rounded down)
+        inline static void halve_in_place(limbs_type& value, uint32_t exponent) noexcept {
+            while (exponent > 0 && !value.empty()) {
+                const auto shift = std::min(exponent, static_cast<uint32_t>(MAX_SHIFT));
+                auto rest = uint64_t(0);
+                for (auto index = value.size(); index > 0; --index) {
+                    const auto current = rest * BASE + value[index - 1];
+                    value[index - 1] = static_cast<uint32_t>(current >> shift);
+                    rest = current & ((uint64_t(1) << shift) - 1);
+                }
+                trim(value);
+                exponent -= shift;
+            }
+        }
+
+        /// writing the decimal digits of given value (0 for an empty value) through a small buffer on the stack
+        inline static std::ostream& write(std::ostream& stream, const limbs_type& value) {
+            char buffer[WRITE_BUFFER_SIZE];
+            auto position = types::to_chars(buffer, value.empty()? uint32_t(0): value.back());
+            for (auto index = value.size(); index > 1; --index) {
+                if (position + DIGITS_PER_LIMB > buffer + WRITE_BUFFER_SIZE) {
+                    stream.write(buffer, position - buffer);
+                    position = buffer;
+                }
+                position = types::to_chars_zero_padded(position, value[index - 2], DIGITS_PER_LIMB);
+            }
+            stream.write(buffer, position - buffer);
+            return stream;
+        }
+
+        /// @return lhs modulo rhs (rhs not 0)
+        inline static limbs_type remainder(const limbs_type& lhs, const limbs_type& rhs) {
+            if (compare(lhs, rhs) < 0) {
+                return lhs;
+            }
+
+            if (rhs.size() == 1) {
+                auto quotient = lhs;
+                return from_u64(divide_in_place(quotient, rhs[0]));
+            }
+
+            if (lhs.size() - rhs.size() < KARATSUBA_THRESHOLD || rhs.size() < KARATSUBA_THRESHOLD) {
+                limbs_type quotient;
+                limbs_type rest;
+                long_division(lhs, rhs, quotient, rest);
+                return rest;
+            }
+            return subtract(lhs, multiply(divide(lhs, rhs), rhs));
+        }
+
+        /// value = value / divisor (rounded down)
+        /// @return value % divisor
+        inline static uint32_t divide_in_place(limbs_type& value, const uint32_t divisor) noexcept {
+            auto rest = uint64_t(0);
+            for (auto index = value.size(); index > 0; --index) {
+                const auto current = rest * BASE + value[index - 1];
+                value[index - 1] = static_cast<uint32_t>(current / divisor);
+                rest = current % divisor;
+            }
+            trim(value);
+            return static_cast<uint32_t>(rest);
+        }
+
+    private:
+        /// type for the sums of products of limbs
+        __extension__ typedef unsigned __int128 wide_type;
+
+        /// The top size + 1 limbs of the divisor are sufficient for a reciprocal with size limbs.
+        /// The reciprocal with about half the limbs - made a little bit too small - is the start
+        /// value for one step of Newton's iteration \f$y' = y \cdot (2 - rhs \cdot y)\f$ (the
+        /// start value of the double is improved until it does not increase anymore).
+        /// @param rhs divisor with two limbs at least
+        /// @param size wanted limbs of the reciprocal
+        /// @return about \f$BASE^{size + rhs.size() - 1} / rhs\f$ (a few units too small at most)
+        inline static limbs_type reciprocal(const limbs_type& rhs, const std::size_t size) {
+            const auto used = std::min(rhs.size(), size + 1);
+            const limbs_type divisor(rhs.end() - static_cast<std::ptrdiff_t>(used), rhs.end());
+            const auto scale = size + used - 1;
+
+            limbs_type y;
+            const auto lifted = size > 6;
+            if (!lifted) {
+                // rhs is about lead * BASE^(used - 2)
+                const auto lead = static_cast<double>(rhs.back()) * BASE + rhs[rhs.size() - 2];
+                y = seed(std::floor(1e27 / lead * (1.0 - 1e-8)), size - 2);
+            } else {
+                const auto half = size / 2 + 3;
+                y = lift(reciprocal(rhs, half), half, size - half);
+            }
+
+            limbs_type two(scale, 0);
+            two.push_back(2);
+            while (true) {
+                // Y' = Y * (2 * BASE^scale - divisor * Y) / BASE^scale
+                auto next = multiply(y, subtract(two, multiply(divisor, y)));
+                next.erase(next.begin(), next.begin() + static_cast<std::ptrdiff_t>(std::min(next.size(), scale)));
+                if (compare(next, y) <= 0) {
+                    break;
+                }
+                y.swap(next);
+                // one step doubles the precision of the lifted start value
+                if (lifted) {
+                    break;
+                }
+            }
+            return y;
+        }
+
+        /// Same precision doubling as for @ref reciprocal: an even count of low limbs of the
+        /// value is dropped for the start value with half the limbs.
+        /// @param value value with three limbs at least
+        /// @param scale fixed point position of the result
+        /// @return about \f$BASE^{scale} / \sqrt{value}\f$ (a few units too small at most)
+        inline static limbs_type reciprocal_square_root(const limbs_type& value, const std::size_t scale) {
+            // value is about lead * BASE^exponent with an even exponent
+            const auto lead_limbs = value.size() % 2 == 0? std::size_t(2): std::size_t(3);
+            const auto exponent = value.size() - lead_limbs;
+            const auto size = scale - exponent / 2;
+
+            limbs_type y;
+            const auto lifted = size > 6;
+            if (!lifted) {
+                auto lead = 0.0;
+                for (auto index = value.size(); index > exponent; --index) {
+                    lead = lead * BASE + value[index - 1];
+                }
+                y = seed(std::floor(1e27 / std::sqrt(lead) * (1.0 - 1e-8)), size - 3);
+            } else {
+                const auto half = size / 2 + 3;
+                const auto dropped = value.size() > half + 3? (value.size() - half - 3) / 2: 0;
+                const limbs_type top(value.begin() + static_cast<std::ptrdiff_t>(2 * dropped), value.end());
+                y = lift(reciprocal_square_root(top, scale - dropped - (size - half)), half, size - half);
+            }
+
+            limbs_type three(2 * scale, 0);
+            three.push_back(3);
+            while (true) {
+                // Y' = Y * (3 * BASE^(2 scale) - value * Y^2) / (2 * BASE^(2 scale))
+                auto next = multiply(y, subtract(three, multiply(value, multiply(y, y))));
+                next.erase(next.begin(), next.begin() + static_cast<std::ptrdiff_t>(std::min(next.size(), 2 * scale)));
+                halve_in_place(next, 1);
+                if (compare(next, y) <= 0) {
+                    break;
+                }
+                y.swap(next);
+                // one step doubles the precision of the lifted start value
+                if (lifted) {
+                    break;
+                }
+            }
+            return y;
+        }
+
+        /// Long division (Knuth, algorithm D): one quotient limb per step estimated
+        /// with the leading limbs of the normalized values (corrected by one at most).
+        /// @param lhs dividend (lhs >= rhs)
+        /// @param rhs divisor with two limbs at least
+        /// @param quotient [out] lhs / rhs
+        /// @param rest [out] lhs % rhs
+        inline static void long_division(const limbs_type& lhs, const limbs_type& rhs,
+                                         limbs_type& quotient, limbs_type& rest) {
+            // normalized: the leading limb of the divisor is BASE / 2 at least (keeping its size)
+            const auto factor = static_cast<uint32_t>(BASE / (uint64_t(rhs.back()) + 1));
+            const auto divisor = multiply_school(rhs, limbs_type(1, factor));
+            auto current = multiply_school(lhs, limbs_type(1, factor));
+            current.resize(lhs.size() + 1, 0);
+
+            const auto size = divisor.size();
+            quotient.assign(lhs.size() - size + 1, 0);
+            for (auto position = quotient.size(); position > 0; --position) {
+                const auto index = position - 1;
+                const auto top = uint64_t(current[index + size]) * BASE + current[index + size - 1];
+                auto estimate = top / divisor[size - 1];
+                auto rest_estimate = top % divisor[size - 1];
+                while (estimate >= BASE
+                       || estimate * divisor[size - 2] > rest_estimate * BASE + current[index + size - 2]) {
+                    --estimate;
+                    rest_estimate += divisor[size - 1];
+                    if (rest_estimate >= BASE) {
+                        break;
+                    }
+                }
+
+                // current -= estimate * divisor * BASE^index
+                auto carry = uint64_t(0);
+                auto borrow = int64_t(0);
+                for (auto limb = std::size_t(0); limb < size; ++limb) {
+                    const auto product = estimate * divisor[limb] + carry;
+                    carry = product / BASE;
+                    auto difference = int64_t(current[index + limb]) - int64_t(product % BASE) - borrow;
+                    borrow = difference < 0? 1: 0;
+                    current[index + limb] = static_cast<uint32_t>(difference + borrow * BASE);
+                }
+                auto top_difference = int64_t(current[index + size]) - int64_t(carry) - borrow;
+
+                // the estimate was one too big: adding the divisor again
+                if (top_difference < 0) {
+                    --estimate;
+                    auto back = uint32_t(0);
+                    for (auto limb = std::size_t(0); limb < size; ++limb) {
+                        const auto sum = current[index + limb] + divisor[limb] + back;
+                        back = sum >= BASE? 1: 0;
+                        current[index + limb] = sum - back * BASE;
+                    }
+                    top_difference += back;
+                }
+                current[index + size] = static_cast<uint32_t>(top_difference);
+                quotient[index] = static_cast<uint32_t>(estimate);
+            }
+
+            trim(quotient);
+            current.resize(size);
+            trim(current);
+            divide_in_place(current, factor);
+            rest.swap(current);
+        }
+
+        /// lhs, rhs = a * lhs + b * rhs, c * lhs + d * rhs (factors below BASE, lhs >= rhs, results not negative)
+        inline static void combine(limbs_type& lhs, limbs_type& rhs,
+                                   const int64_t a, const int64_t b, const int64_t c, const int64_t d) noexcept {
+            // the offset keeps the values positive for an unsigned division by BASE
+            const auto offset = uint64_t(4000000000ULL) * BASE;
+            rhs.resize(lhs.size(), 0);
+            auto lhs_carry = int64_t(0);
+            auto rhs_carry = int64_t(0);
+            for (auto index = std::size_t(0); index < lhs.size(); ++index) {
+                const auto lhs_value = static_cast<uint64_t>(a * lhs[index] + b * rhs[index] + lhs_carry) + offset;
+                const auto rhs_value = static_cast<uint64_t>(c * lhs[index] + d * rhs[index] + rhs_carry) + offset;
+                const auto lhs_quotient = lhs_value / BASE;
+                const auto rhs_quotient = rhs_value / BASE;
+                lhs[index] = static_cast<uint32_t>(lhs_value - lhs_quotient * BASE);
+                rhs[index] = static_cast<uint32_t>(rhs_value - rhs_quotient * BASE);
+                lhs_carry = static_cast<int64_t>(lhs_quotient) - 4000000000LL;
+                rhs_carry = static_cast<int64_t>(rhs_quotient) - 4000000000LL;
+            }
+            trim(lhs);
+            trim(rhs);
+        }
+
+        /// @return start * BASE^shift for a start value below 10^27
+        inline static limbs_type seed(const double start, const std::size_t shift) {
+            limbs_type result(shift, 0);
+            result.push_back(static_cast<uint32_t>(std::fmod(start, 1e9)));
+            result.push_back(static_cast<uint32_t>(std::fmod(std::floor(start / 1e9), 1e9)));
+            result.push_back(static_cast<uint32_t>(std::floor(start / 1e18)));
+            trim(result);
+            return result;
+        }
+
+        /// @param value approximation with given limbs (relative error below BASE^-(limbs - 2))
+        /// @return value * (1 - BASE^-(limbs - 2)) * BASE^shift (too small for the higher precision)
+        inline static limbs_type lift(limbs_type value, const std::size_t limbs, const std::size_t shift) {
+            const limbs_type margin(value.begin() + static_cast<std::ptrdiff_t>(std::min(value.size(), limbs - 2)),
+                                    value.end());
+            subtract_in_place(value, margin);
+            value.insert(value.begin(), shift, 0);
+            return value;
+        }
+};
+
+}  // namespace detail
+}  // namespace math
+
+#endif  // INCLUDE_MATH_DECIMAL_LIMBS_H_
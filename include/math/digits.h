@@ -23,82 +23,322 @@
 #ifndef INCLUDE_MATH_DIGITS_H_
 #define INCLUDE_MATH_DIGITS_H_
 
-#include <set>
+#include <types/type_traits.h>
+#include <type_traits>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 namespace math {
 
 /// @struct digits
+/// @brief digit algorithms without any allocation.
+///
+/// The kernels take two decimal digits per step (one division by 100)
+/// using tables with 100 entries for the pairs 00..99. The digits found by
+/// @ref is_pandigital are tracked in a 10 bit mask. Negative numbers are
+/// handled by their magnitude (sum and reverse keep the sign).
 template <typename T>
 struct digits final {
+    static_assert(std::is_integral<T>::value, "digits<T> requires an integral type");
+
+    /// unsigned type for the magnitude of a number
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
     /// @return sum of digits
     inline static T sum(const T number) noexcept {
-        auto result = T(0);
-        for (auto n = number; n != 0; n /= 10) {
-            result += n % 10;
+        auto result = unsigned_type(0);
+        for (auto n = magnitude(number); n != 0; n /= 100) {
+            result += PAIR_SUM[static_cast<std::size_t>(n % 100)];
         }
-        return result;
+        return with_sign(number, result);
     }
 
     /// @return number of digits
     inline static T count(const T number) noexcept {
-        if (0 == number) {
-            return 1;
-        }
-
-        auto result = T(0);
-        for (auto n = number; n != 0; n /= 10) {
-            ++result;
+        auto result = T(1);
+        for (auto n = magnitude(number); n >= 10; n /= 100) {
+            result += n >= 100? 2: 1;
         }
         return result;
     }
 
     /// Checks that each digit appears once only
-    /// @return true when given number is pandigital
+    /// @return true when given number is pandigital (false for 0)
     /// @see http://en.wikipedia.org/wiki/Pandigital_number
     inline static bool is_pandigital(const T number) noexcept {
-        std::set<unsigned char> digits;
-        for (auto n = number; n != 0; n /= 10) {
-            digits.insert(n % 10);
+        if (number == 0) {
+            return false;
         }
 
-        return static_cast<std::set<unsigned char>::size_type>(count(number)) == digits.size();
+        // the marker bit is set from the beginning: a pair with equal digits fails like a digit seen before
+        auto mask = static_cast<unsigned>(DUPLICATE);
+        auto n = magnitude(number);
+        for (; n >= 10; n /= 100) {
+            const auto pair = PAIR_MASK[static_cast<std::size_t>(n % 100)];
+            if ((mask & pair) != 0) {
+                return false;
+            }
+            mask |= pair;
+        }
+        // leading single digit (if any)
+        return n == 0 || (mask & (1u << n)) == 0;
     }
 
     /// Check that given number is a palindrom like: 161, 2332, ..
+    /// The digits of the lower half are reversed and compared with the upper half.
     /// @return true when given number is a palindrom
     /// @see http://en.wikipedia.org/wiki/Palindromic_number
     inline static bool is_palindrome(const T number) noexcept {
-        std::vector<unsigned char> digits;
-        for (auto n = number; n != 0; n /= 10) {
-            digits.push_back(n % 10);
+        const auto n = magnitude(number);
+        if (n < 10) {
+            return true;
         }
 
-        const auto max_idx = static_cast<uint64_t>(digits.size() - 1);
-        for (auto left = static_cast<uint64_t>(0), right = max_idx; left < right; ++left, --right) {
-            if (digits[left] != digits[right]) {
-                return false;
-            }
-        }
+        const auto length = static_cast<unsigned>(count(number));
+        const auto half = length / 2;
+        const auto divisor = power_of_ten(half);
 
-        return true;
+        // the middle digit of an odd number of digits is skipped
+        const auto upper = length % 2 == 0? n / divisor: n / divisor / 10;
+        return reverse_digits(n % divisor, half) == upper;
     }
 
     /// @Generating reversed integer like: 12345 => 54321.
     /// @param number the integer to get reversed
     /// @return reverse integer
     inline static T reverse(const T number) noexcept {
-        auto result = T(0);
-        for (auto n = number; n != 0; n /= 10) {
-            result = result * 10 + n % 10;
+        auto result = unsigned_type(0);
+        auto n = magnitude(number);
+        for (; n >= 10; n /= 100) {
+            result = result * 100 + PAIR_REVERSED[static_cast<std::size_t>(n % 100)];
+        }
+        if (n != 0) {
+            result = result * 10 + n;
+        }
+        return with_sign(number, result);
+    }
+
+    /// Checking a range of numbers for being pandigital.
+    /// @param numbers pointer to first number
+    /// @param count number of numbers
+    /// @param results one entry per number (1 when pandigital otherwise 0)
+    inline static void is_pandigital_batch(const T* numbers, const std::size_t count,
+                                           uint8_t* results) noexcept {
+        for (auto index = std::size_t(0); index < count; ++index) {
+            results[index] = is_pandigital(numbers[index])? 1: 0;
+        }
+    }
+
+    /// Checking a range of numbers for being palindromes.
+    /// @param numbers pointer to first number
+    /// @param count number of numbers
+    /// @param results one entry per number (1 when palindrome otherwise 0)
+    inline static void is_palindrome_batch(const T* numbers, const std::size_t count,
+                                           uint8_t* results) noexcept {
+        for (auto index = std::size_t(0); index < count; ++index) {
+            results[index] = is_palindrome(numbers[index])? 1: 0;
+        }
+    }
+
+    /// Calling given function for each palindrome in [first, last] in increasing order.
+    /// The palindromes are constructed from their leading half (for n digits
+    /// there are about \f$10^{n/2}\f$ palindromes only).
+    /// @param first smallest number to consider (negative numbers are skipped)
+    /// @param last biggest number to consider
+    /// @param function called with each palindrome
+    template <typename F>
+    inline static void for_each_palindrome(const T first, const T last, F function) {
+        if (is_negative(last, std::is_signed<T>())) {
+            return;
+        }
+
+        const auto lo = is_negative(first, std::is_signed<T>())? unsigned_type(0): magnitude(first);
+        const auto hi = magnitude(last);
+        const auto min_length = static_cast<unsigned>(count(static_cast<T>(lo)));
+        const auto max_length = static_cast<unsigned>(count(last));
+        for (auto length = min_length; lo <= hi && length <= max_length; ++length) {
+            // the lowest digits (tail) are the mirrored leading digits (head) without the middle digit
+            const auto tail = length / 2;
+            const auto scale = power_of_ten(tail);
+            const auto head_end = power_of_ten(length - tail);
+            auto head = length == min_length? lo / scale: head_end / 10;
+            for (; head < head_end; ++head) {
+                if (head > hi / scale) {
+                    return;
+                }
+
+                const auto base = head * scale;
+                const auto mirrored = reverse_digits(length % 2 == 0? head: head / 10, tail);
+                if (mirrored > hi - base) {
+                    return;
+                }
+
+                if (base + mirrored >= lo) {
+                    function(static_cast<T>(base + mirrored));
+                }
+            }
+        }
+    }
+
+    /// Calling given function for each pandigital number (each digit once only)
+    /// in [first, last] in increasing order. The numbers are constructed digit by
+    /// digit from the left skipping the digits already used and the prefixes
+    /// outside of the range.
+    /// @param first smallest number to consider (negative numbers are skipped)
+    /// @param last biggest number to consider
+    /// @param function called with each pandigital number
+    template <typename F>
+    inline static void for_each_pandigital(const T first, const T last, F function) {
+        if (is_negative(last, std::is_signed<T>())) {
+            return;
+        }
+
+        const auto lo = is_negative(first, std::is_signed<T>())? unsigned_type(0): magnitude(first);
+        const auto hi = magnitude(last);
+        const auto min_length = static_cast<unsigned>(count(static_cast<T>(lo)));
+        const auto max_length = std::min(static_cast<unsigned>(count(last)), 10u);
+        for (auto length = min_length; lo <= hi && length <= max_length; ++length) {
+            if (!extend_pandigital(unsigned_type(0), 0u, length, lo, hi, function)) {
+                return;
+            }
+        }
+    }
+
+    private:
+    /// marker bit (above the 10 bits for the digits) for pairs with two equal digits
+    enum {DUPLICATE = 1 << 10};
+
+    /// table with a value for each pair of digits 00..99
+    template <typename V>
+    struct pair_table final {
+        /// the values
+        V values[100];
+
+        /// @return value for given pair (0..99)
+        constexpr V operator [] (const std::size_t pair) const noexcept {
+            return values[pair];
+        }
+    };
+
+    /// @return digit mask of given pair (DUPLICATE when both digits are equal)
+    static constexpr uint16_t pair_mask(const std::size_t pair) noexcept {
+        return static_cast<uint16_t>((pair / 10 == pair % 10? DUPLICATE: 0)
+                                     | (1 << (pair / 10)) | (1 << (pair % 10)));
+    }
+
+    /// @return R initialized with the digit masks of the pairs 00..99
+    template <typename R, std::size_t... I>
+    static constexpr R make_masks(types::index_sequence<I...>) noexcept {
+        return R{{pair_mask(I)...}};
+    }
+
+    /// @return R initialized with the digit sums of the pairs 00..99
+    template <typename R, std::size_t... I>
+    static constexpr R make_sums(types::index_sequence<I...>) noexcept {
+        return R{{static_cast<uint8_t>(I / 10 + I % 10)...}};
+    }
+
+    /// @return R initialized with the reversed pairs 00..99
+    template <typename R, std::size_t... I>
+    static constexpr R make_reversed(types::index_sequence<I...>) noexcept {
+        return R{{static_cast<uint8_t>(I % 10 * 10 + I / 10)...}};
+    }
+
+    /// digit mask for each pair of digits (DUPLICATE when both digits are equal)
+    static constexpr pair_table<uint16_t> PAIR_MASK =
+        make_masks<pair_table<uint16_t>>(types::make_index_sequence<100>());
+    /// digit sum for each pair of digits
+    static constexpr pair_table<uint8_t> PAIR_SUM =
+        make_sums<pair_table<uint8_t>>(types::make_index_sequence<100>());
+    /// reversed pair for each pair of digits (12 => 21, 10 => 01)
+    static constexpr pair_table<uint8_t> PAIR_REVERSED =
+        make_reversed<pair_table<uint8_t>>(types::make_index_sequence<100>());
+
+    /// @return true when given number is negative (signed version)
+    inline static bool is_negative(const T number, std::true_type) noexcept {
+        return number < 0;
+    }
+
+    /// @return always false (unsigned version)
+    inline static bool is_negative(const T, std::false_type) noexcept {
+        return false;
+    }
+
+    /// @return magnitude of given number as unsigned value
+    inline static unsigned_type magnitude(const T number) noexcept {
+        return is_negative(number, std::is_signed<T>())? unsigned_type(0) - static_cast<unsigned_type>(number)
+                                                        : static_cast<unsigned_type>(number);
+    }
+
+    /// @return given value with the sign of given number
+    inline static T with_sign(const T number, const unsigned_type value) noexcept {
+        return static_cast<T>(is_negative(number, std::is_signed<T>())? unsigned_type(0) - value: value);
+    }
+
+    /// @return \f$10^{exponent}\f$
+    inline static unsigned_type power_of_ten(const unsigned exponent) noexcept {
+        auto result = unsigned_type(exponent % 2 == 0? 1: 10);
+        for (auto step = exponent / 2; step != 0; --step) {
+            result *= 100;
         }
         return result;
     }
 
+    /// Appending the unused digits to given prefix (see @ref for_each_pandigital).
+    /// @return false when the numbers are behind the range (no more calls required)
+    template <typename F>
+    static bool extend_pandigital(const unsigned_type prefix, const unsigned mask, const unsigned remaining,
+                                  const unsigned_type lo, const unsigned_type hi, F& function) {
+        if (remaining == 0) {
+            if (prefix >= lo) {
+                function(static_cast<T>(prefix));
+            }
+            return true;
+        }
+
+        const auto scale = power_of_ten(remaining - 1);
+        // no leading zero (except for the number 0 itself)
+        for (auto digit = (prefix == 0 && remaining > 1)? 1u: 0u; digit < 10; ++digit) {
+            if ((mask & (1u << digit)) != 0) {
+                continue;
+            }
+
+            const auto candidate = prefix * 10 + digit;
+            if (candidate > hi / scale) {
+                return false;
+            }
+
+            if (candidate >= lo / scale
+                && !extend_pandigital(candidate, mask | (1u << digit), remaining - 1, lo, hi, function)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @return the lowest given count of digits of given value in reversed order
+    inline static unsigned_type reverse_digits(unsigned_type value, const unsigned count) noexcept {
+        auto result = unsigned_type(0);
+        for (auto step = count / 2; step != 0; --step, value /= 100) {
+            result = result * 100 + PAIR_REVERSED[static_cast<std::size_t>(value % 100)];
+        }
+        return count % 2 == 0? result: result * 10 + value % 10;
+    }
+
     /// instantiation is not wanted
     digits() = delete;
 };
 
+template <typename T>
+constexpr typename digits<T>::template pair_table<uint16_t> digits<T>::PAIR_MASK;
+
+template <typename T>
+constexpr typename digits<T>::template pair_table<uint8_t> digits<T>::PAIR_SUM;
+
+template <typename T>
+constexpr typename digits<T>::template pair_table<uint8_t> digits<T>::PAIR_REVERSED;
+
 }  // namespace math
 
 #endif  // INCLUDE_MATH_DIGITS_H_
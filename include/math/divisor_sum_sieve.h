@@ -0,0 +1,111 @@
+///
+/// @author  Thomas Lehmann
+/// @file    divisor_sum_sieve.h
+/// @brief   sum of divisors (sigma) for all numbers up to a limit
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_DIVISOR_SUM_SIEVE_H_
+#define INCLUDE_MATH_DIVISOR_SUM_SIEVE_H_
+
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+namespace math {
+
+/// @class divisor_sum_sieve
+/// @brief sum of divisors \f$\sigma(n)\f$ for all numbers n <= max_n in O(N log N).
+///
+/// Each divisor pair (d, k) with d <= k and d * k = n adds d + k to the sum of n.
+/// The numbers are processed in segments fitting into the cache; for each segment
+/// the divisors d up to the square root of its last number walk through their
+/// multiples d * k (k >= d) inside the segment.
+///
+/// @code
+/// math::divisor_sum_sieve<uint32_t> sieve(100000000);
+/// sieve.calculate();
+/// sieve.sum_of_divisors(12);            // 28
+/// sieve.sum_of_proper_divisors(12);     // 16
+/// @endcode
+///
+/// @note T has to be able to keep sigma(max_n); uint32_t is enough for max_n up to 7 * 10^8.
+template <typename T = uint64_t>
+class divisor_sum_sieve final {
+    public:
+        /// type of the sums
+        using value_type = T;
+
+        /// numbers processed at once
+        enum {SEGMENT_SIZE = 32768};
+
+        /// init c'tor
+        /// @param max_n biggest number for which to calculate the sum of divisors
+        explicit divisor_sum_sieve(const uint64_t max_n)
+            : m_max_n(max_n), m_sums(max_n + 1, 0) {
+        }
+
+        /// calculating the sums of the divisors
+        void calculate() noexcept {
+            for (auto low = uint64_t(1); low <= m_max_n; low += SEGMENT_SIZE) {
+                const auto high = std::min(m_max_n, low + SEGMENT_SIZE - 1);
+
+                for (auto divisor = uint64_t(1); divisor * divisor <= high; ++divisor) {
+                    auto partner = std::max(divisor, (low + divisor - 1) / divisor);
+                    auto multiple = divisor * partner;
+                    if (partner == divisor) {
+                        // square root of the number
+                        m_sums[multiple] += static_cast<value_type>(divisor);
+                        ++partner;
+                        multiple += divisor;
+                    }
+
+                    for (; multiple <= high; multiple += divisor, ++partner) {
+                        m_sums[multiple] += static_cast<value_type>(divisor + partner);
+                    }
+                }
+            }
+        }
+
+        /// @return biggest number for which the sum of divisors is known
+        uint64_t max_number() const noexcept {
+            return m_max_n;
+        }
+
+        /// @param number number <= max_number()
+        /// @return sum of all divisors including the number itself (0 for 0)
+        value_type sum_of_divisors(const uint64_t number) const noexcept {
+            return m_sums[number];
+        }
+
+        /// @param number number <= max_number()
+        /// @return sum of all divisors excluding the number itself
+        value_type sum_of_proper_divisors(const uint64_t number) const noexcept {
+            return m_sums[number] - static_cast<value_type>(number);
+        }
+
+    private:
+        /// biggest number for which to calculate the sum of divisors
+        uint64_t m_max_n;
+        /// sum of divisors for each number
+        std::vector<value_type> m_sums;
+};
+
+}  // namespace math
+
+#endif  // INCLUDE_MATH_DIVISOR_SUM_SIEVE_H_
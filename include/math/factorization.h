@@ -23,7 +23,11 @@
 #ifndef INCLUDE_MATH_FACTORIZATION_H_
 #define INCLUDE_MATH_FACTORIZATION_H_
 
+#include <algorithm>
+#include <utility>
 #include <vector>
+#include <cstddef>
+#include <cstdint>
 
 namespace math {
 
@@ -32,24 +36,106 @@ template <typename T>
 struct factorization final {
     /// type of container of values
     using container_type = std::vector<T>;
+    /// prime factors with their exponents in increasing order of the primes
+    using factors_type = std::vector<std::pair<T, T>>;
 
-    /// The divisors for 10 are 1, 2, 5 and 10.
+    /// The divisors for 10 are 1, 2, 5 and 10. The divisors are found
+    /// in pairs (d, value / d) checking d up to the square root of value only.
     /// @param value [in] value for which to find all factors
-    /// @param divisors [out] found divisors
+    /// @param divisors [out] found divisors (in increasing order; 1 and the value for values < 1)
     inline static void probe(const T value, container_type& divisors) noexcept {
-        const auto limit = value / 2;
-
         divisors.clear();
-        divisors.push_back(1);
 
-        for (auto divisor = 2; divisor <= limit; ++divisor) {
+        if (value < 1) {
+            // as the enumeration up to value / 2 did before (0 has the "divisors" 1 and 0)
+            divisors.push_back(1);
+            divisors.push_back(value);
+            return;
+        }
+
+        for (T divisor = 1; divisor <= value / divisor; ++divisor) {
             if (value % divisor == 0) {
                 divisors.push_back(divisor);
             }
         }
 
-        if (1 != value) {
-            divisors.push_back(value);
+        // the partners in increasing order (the square root once only)
+        for (auto index = divisors.size(); index > 0; --index) {
+            const auto partner = value / divisors[index - 1];
+            if (partner != divisors[index - 1]) {
+                divisors.push_back(partner);
+            }
+        }
+    }
+
+    /// The prime factors of 360 are 2^3, 3^2 and 5^1.
+    /// @param value [in] value (>= 1) to factorize
+    /// @param factors [out] prime factors with their exponents
+    inline static void prime_factors(const T value, factors_type& factors) noexcept {
+        factors.clear();
+        for_each_prime_power(value, [&factors](const T prime, const T exponent, const uint64_t) {
+            factors.push_back(std::make_pair(prime, exponent));
+        });
+    }
+
+    /// Generating the divisors from a prime factorization; useful when
+    /// the factorization is known already (or comes from a sieve).
+    /// @param factors [in] prime factors with their exponents
+    /// @param divisors [out] all divisors (in increasing order)
+    inline static void divisors(const factors_type& factors, container_type& divisors) noexcept {
+        divisors.assign(1, 1);
+        for (const auto& factor: factors) {
+            // each known divisor multiplied by p, p^2, ..., p^exponent
+            const auto count = divisors.size();
+            T power = 1;
+            for (T nth = 0; nth < factor.second; ++nth) {
+                power *= factor.first;
+                for (auto index = static_cast<std::size_t>(0); index < count; ++index) {
+                    divisors.push_back(divisors[index] * power);
+                }
+            }
+        }
+        std::sort(divisors.begin(), divisors.end());
+    }
+
+    /// The sum of the divisors is the product of the sums 1 + p + ... + p^e
+    /// for each prime power p^e of the number; no divisor is stored.
+    /// The sum is accumulated with 64 bit: it does not fit into T for many values.
+    /// @param value value for which to sum the divisors
+    /// @return sum of all divisors including the value itself (sigma(12) = 28; 1 for values < 2
+    ///         like the sum of the divisors 1 and 0 of @ref probe for 0)
+    inline static uint64_t sum_of_divisors(const T value) noexcept {
+        auto sum = uint64_t(1);
+        for_each_prime_power(value, [&sum](const T, const T, const uint64_t sum_of_powers) {
+            sum *= sum_of_powers;
+        });
+        return sum;
+    }
+
+    /// Trial division by 2 and the odd numbers up to the square root of the rest.
+    /// @param value value (>= 1) to factorize
+    /// @param function called as function(prime, exponent, 1 + prime + ... + prime^exponent)
+    ///                 for each prime power in increasing order of the primes (the sum as uint64_t)
+    template <typename F>
+    inline static void for_each_prime_power(const T value, F function) noexcept {
+        T rest = value;
+        for (T prime = 2; prime <= rest / prime; prime += (prime == 2)? 1: 2) {
+            if (rest % prime == 0) {
+                T exponent = 0;
+                auto power = uint64_t(1);
+                auto sum_of_powers = uint64_t(1);
+                do {
+                    rest /= prime;
+                    power *= prime;
+                    sum_of_powers += power;
+                    ++exponent;
+                } while (rest % prime == 0);
+                function(prime, exponent, sum_of_powers);
+            }
+        }
+
+        if (rest > 1) {
+            function(rest, 1, static_cast<uint64_t>(rest) + 1);
         }
     }
 
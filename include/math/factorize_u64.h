@@ -0,0 +1,185 @@
+///
+/// @author  Thomas Lehmann
+/// @file    factorize_u64.h
+/// @brief   prime factorization of 64 bit numbers (Pollard-Brent rho)
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_FACTORIZE_U64_H_
+#define INCLUDE_MATH_FACTORIZE_U64_H_
+
+#include <math/factorization.h>
+#include <math/prime/miller_rabin.h>
+#include <math/prime/small_primes.h>
+
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+namespace math {
+
+/// @class pollard_brent
+/// @brief finding a factor of a composite 64 bit number (rho algorithm with the cycle detection of Brent).
+///
+/// The sequence y = y^2 + c mod n is iterated in Montgomery form; the differences
+/// |x - y| are multiplied up and one gcd is calculated for a batch of steps only.
+/// When the gcd of a batch is n the batch is repeated step by step.
+///
+/// @see https://maths-people.anu.edu.au/~brent/pd/rpb051i.pdf
+class pollard_brent final {
+    public:
+        /// steps between two gcd calculations
+        enum {BATCH_SIZE = 128};
+
+        /// no instances
+        pollard_brent() = delete;
+
+        /// @param number odd composite number
+        /// @return a factor of given number (1 < factor < number)
+        static uint64_t find_factor(const uint64_t number) noexcept {
+            const prime::montgomery_u64 arithmetic(number);
+            for (auto c = arithmetic.one(); ; c = arithmetic.add(c, arithmetic.one())) {
+                const auto factor = find_factor(arithmetic, c);
+                if (factor != number) {
+                    return factor;
+                }
+            }
+        }
+
+        /// @return greatest common divisor of given values
+        static uint64_t gcd(uint64_t lhs, uint64_t rhs) noexcept {
+            while (rhs != 0) {
+                const auto rest = lhs % rhs;
+                lhs = rhs;
+                rhs = rest;
+            }
+            return lhs;
+        }
+
+    private:
+        /// @return factor of the number or the number itself when the sequence for c failed
+        static uint64_t find_factor(const prime::montgomery_u64& arithmetic, const uint64_t c) noexcept {
+            const auto number = arithmetic.modulus();
+            const auto next = [&arithmetic, c](const uint64_t value) {
+                return arithmetic.add(arithmetic.multiply(value, value), c);
+            };
+            const auto distance = [](const uint64_t lhs, const uint64_t rhs) {
+                return lhs > rhs? lhs - rhs: rhs - lhs;
+            };
+
+            auto y = arithmetic.one();
+            auto x = y;
+            auto saved_y = y;
+            auto product = arithmetic.one();
+            auto factor = uint64_t(1);
+
+            for (auto length = uint64_t(1); factor == 1; length *= 2) {
+                x = y;
+                for (auto step = uint64_t(0); step < length; ++step) {
+                    y = next(y);
+                }
+
+                for (auto done = uint64_t(0); done < length && factor == 1; done += BATCH_SIZE) {
+                    saved_y = y;
+                    const auto steps = std::min(static_cast<uint64_t>(BATCH_SIZE), length - done);
+                    for (auto step = uint64_t(0); step < steps; ++step) {
+                        y = next(y);
+                        product = arithmetic.multiply(product, distance(x, y));
+                    }
+                    factor = gcd(product, number);
+                }
+            }
+
+            if (factor == number) {
+                // the batch has collected all factors: repeating it step by step
+                do {
+                    saved_y = next(saved_y);
+                    factor = gcd(distance(x, saved_y), number);
+                } while (factor == 1);
+            }
+
+            return factor;
+        }
+};
+
+/// Prime factorization of a 64 bit number: trial division by the primes
+/// below 1024, then splitting the rest with @ref pollard_brent until
+/// @ref prime::miller_rabin confirms each part to be a prime.
+///
+/// @code
+/// math::factorize_u64(360);  // (2, 3), (3, 2), (5, 1)
+/// @endcode
+///
+/// @param value value to factorize (0 and 1 do not have prime factors)
+/// @return prime factors with their exponents in increasing order of the primes
+inline factorization<uint64_t>::factors_type factorize_u64(const uint64_t value) {
+    factorization<uint64_t>::factors_type factors;
+    if (value < 2) {
+        return factors;
+    }
+
+    auto rest = value;
+    for (const auto prime: prime::small_primes::primes) {
+        if (prime >= 1024 || uint64_t(prime) * prime > rest) {
+            break;
+        }
+
+        if (rest % prime == 0) {
+            auto exponent = uint64_t(0);
+            for (; rest % prime == 0; rest /= prime) {
+                ++exponent;
+            }
+            factors.push_back(std::make_pair(uint64_t(prime), exponent));
+        }
+    }
+
+    // the rest has prime factors >= 1024 only
+    std::vector<uint64_t> primes;
+    std::vector<uint64_t> parts;
+    if (rest > 1) {
+        parts.push_back(rest);
+    }
+
+    while (!parts.empty()) {
+        const auto part = parts.back();
+        parts.pop_back();
+
+        if (part < 1024 * 1024 || prime::miller_rabin::is_prime(part)) {
+            primes.push_back(part);
+        } else {
+            const auto factor = pollard_brent::find_factor(part);
+            parts.push_back(factor);
+            parts.push_back(part / factor);
+        }
+    }
+
+    std::sort(primes.begin(), primes.end());
+    for (const auto prime: primes) {
+        if (!factors.empty() && factors.back().first == prime) {
+            ++factors.back().second;
+        } else {
+            factors.push_back(std::make_pair(prime, uint64_t(1)));
+        }
+    }
+
+    return factors;
+}
+
+}  // namespace math
+
+#endif  // INCLUDE_MATH_FACTORIZE_U64_H_
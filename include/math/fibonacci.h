@@ -24,14 +24,28 @@
 #ifndef INCLUDE_MATH_FIBONACCI_H_
 #define INCLUDE_MATH_FIBONACCI_H_
 
+#include <math/big_integer.h>
+#include <math/decimal_limbs.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 #include <cstdint>
 
 namespace math {
 
 /// @class fibonacci
 /// @brief tool class for static fibonacci functions.
+///
+/// The functions for an index are using fast doubling with
+/// \f$F(2k) = F(k) \cdot (2F(k+1) - F(k))\f$ and \f$F(2k+1) = F(k)^2 + F(k+1)^2\f$
+/// walking through the bits of the index: O(log n) steps instead of n additions.
 class fibonacci final {
     public:
+        /// biggest index for which the fibonacci value fits into 64 bit
+        enum {MAX_INDEX_U64 = 93};
+
         /// @param index zero based index in the fibonacci sequence.
         /// @return fibonacci value at given index in its sequence.
         ///
@@ -41,31 +55,111 @@ class fibonacci final {
         ///     assert_that(fibonacci_sequence[index], is_equal(math::fibonacci::by_index(index)));
         /// }
         /// @endcode
+        /// @note values behind index 47 do not fit into 32 bit (modulo 2^32 then)
         inline static uint32_t by_index(const uint32_t index) noexcept {
-            if (0 == index) {
-                return 0;
+            return fast_doubling<uint32_t>(index).first;
+        }
+
+        /// @param index zero based index in the fibonacci sequence.
+        /// @return fibonacci value at given index in its sequence.
+        /// @throw std::overflow_error when the value does not fit into 64 bit (index > 93)
+        inline static uint64_t by_index_u64(const uint32_t index) {
+            if (index > MAX_INDEX_U64) {
+                throw std::overflow_error("fibonacci value does not fit into 64 bit");
             }
+            return fast_doubling<uint64_t>(index).first;
+        }
+
+        /// @param index zero based index in the fibonacci sequence.
+        /// @return fibonacci value at given index in its sequence (F(10^6) has 208988 digits).
+        inline static big_integer by_index_big(const uint32_t index) {
+            limbs_type current;
+            limbs_type next(1, 1);
+            limbs_type twice;
 
-            if (index <= 2) {
-                return 1;
+            for (auto bit = highest_bit(index); bit > 0; --bit) {
+                // (F(k), F(k+1)) -> (F(2k), F(2k+1))
+                twice = detail::decimal_limbs::add(next, next);
+                auto even = detail::decimal_limbs::multiply(current, detail::decimal_limbs::subtract(twice, current));
+                auto odd = detail::decimal_limbs::add(detail::decimal_limbs::multiply(current, current),
+                                                      detail::decimal_limbs::multiply(next, next));
+
+                if ((index >> (bit - 1)) & 1) {
+                    // (F(2k+1), F(2k+2))
+                    current = std::move(odd);
+                    next = detail::decimal_limbs::add(even, current);
+                } else {
+                    current = std::move(even);
+                    next = std::move(odd);
+                }
             }
 
-           auto last_before_last = static_cast<uint32_t>(1);
-           auto last = static_cast<uint32_t>(1);
+            return detail::decimal_limbs::to_big_integer(current);
+        }
 
-           auto current_index = index - 2;
-           while (current_index-- > 0) {
-               const auto temp = last + last_before_last;
-               last_before_last = last;
-               last = temp;
-           }
+        /// @param count number of fibonacci values to provide (F(0) to F(count-1))
+        /// @param values [out] the values (the capacity of the container is reused)
+        /// @throw std::overflow_error when the values do not fit into 64 bit (count > 94)
+        inline static void sequence(const uint32_t count, std::vector<uint64_t>& values) {
+            if (count > MAX_INDEX_U64 + 1) {
+                throw std::overflow_error("fibonacci value does not fit into 64 bit");
+            }
 
-           return last;
+            values.resize(count);
+            for (auto index = uint32_t(0); index < count; ++index) {
+                values[index] = index < 2? index: values[index - 1] + values[index - 2];
+            }
+        }
+
+        /// @param count number of fibonacci values to provide (F(0) to F(count-1))
+        /// @param values [out] the values as big integer (two rolling buffers for the additions)
+        inline static void sequence(const uint32_t count, std::vector<big_integer>& values) {
+            values.clear();
+            values.reserve(count);
+
+            limbs_type previous(1, 1);
+            limbs_type current;
+            for (auto index = uint32_t(0); index < count; ++index) {
+                values.push_back(detail::decimal_limbs::to_big_integer(current));
+                detail::decimal_limbs::add_in_place(previous, current);
+                std::swap(previous, current);
+            }
         }
 
     private:
+        /// base 10^9 digits
+        using limbs_type = detail::decimal_limbs::limbs_type;
+
         /// disable c'tor
         fibonacci() = delete;
+
+        /// @return (F(index), F(index + 1)) using the natural overflow of T
+        template <typename T>
+        inline static std::pair<T, T> fast_doubling(const uint32_t index) noexcept {
+            auto current = T(0);
+            auto next = T(1);
+            for (auto bit = highest_bit(index); bit > 0; --bit) {
+                const auto even = static_cast<T>(current * static_cast<T>(2 * next - current));
+                const auto odd = static_cast<T>(current * current + next * next);
+                if ((index >> (bit - 1)) & 1) {
+                    current = odd;
+                    next = static_cast<T>(even + odd);
+                } else {
+                    current = even;
+                    next = odd;
+                }
+            }
+            return std::make_pair(current, next);
+        }
+
+        /// @return number of bits of given index without leading zeros
+        inline static uint32_t highest_bit(const uint32_t index) noexcept {
+            auto bits = uint32_t(0);
+            for (auto rest = index; rest != 0; rest >>= 1) {
+                ++bits;
+            }
+            return bits;
+        }
 };
 
 }  // namespace math
@@ -23,19 +23,50 @@
 #ifndef INCLUDE_MATH_FRACTION_H_
 #define INCLUDE_MATH_FRACTION_H_
 
+#include <math/big_integer.h>
+#include <math/decimal_limbs.h>
+#include <math/isqrt.h>
+#include <types/bit_operations.h>
+
 #include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdint>
 
 namespace math {
 
+template <typename T>
+class fraction_sum;
+
 /// @class fraction
 /// @brief  math fraction.
+///
+/// The fraction is always reduced with the sign at the numerator (binary gcd)
+/// so equal fractions have equal numerators and denominators. Intermediate
+/// products are calculated with twice the bits of T (128 bit for 64 bit
+/// integers) and a result that does not fit into T is reported.
+///
+/// @code
+/// constexpr math::fraction<int64_t> f = math::fraction<int64_t>(1, 6) + math::fraction<int64_t>(1, 3);   // 1/2
+/// @endcode
 /// @note read here: http://en.wikipedia.org/wiki/Fraction_%28mathematics%29
 template <typename T>
 class fraction final {
+    static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(uint64_t), "integer values allowed only");
+
     public:
-        /// init c'tor
-        constexpr fraction(const T numerator, const T denominator) noexcept
-            : m_numerator(numerator), m_denominator(denominator) {
+        /// type of numerator and denominator
+        using value_type = T;
+        /// unsigned type with twice the bits of T for the magnitudes of the intermediate results
+        using wide_type = typename std::conditional<sizeof(T) <= sizeof(uint32_t), uint64_t, uint128_type>::type;
+
+        /// init c'tor (reducing the fraction)
+        /// @throw std::runtime_error when the denominator is 0
+        /// @throw std::overflow_error when the reduced fraction does not fit into T (unsigned and negative)
+        constexpr fraction(const T numerator, const T denominator)
+            : fraction(make(is_negative(numerator) != is_negative(denominator),
+                            magnitude(numerator), magnitude(denominator))) {
         }
 
         /// value above the line (or before the slash)
@@ -52,42 +83,42 @@ class fraction final {
 
         /// Does calculate the sum of two fractions like \f$\frac{1}{2}+\frac{2}{3}=\frac{7}{6}\f$
         /// @return sum of two fractions
-        constexpr friend fraction operator + (const fraction& lhs, const fraction& rhs) noexcept {
-            return fraction(lhs.get_numerator() * rhs.get_denominator() +
-                            lhs.get_denominator() * rhs.get_numerator(),
-                            lhs.get_denominator() * rhs.get_denominator());
+        /// @throw std::overflow_error when the result does not fit into T
+        constexpr friend fraction operator + (const fraction& lhs, const fraction& rhs) {
+            return add(is_negative(lhs.m_numerator), magnitude(lhs.m_numerator), wide_type(lhs.m_denominator),
+                       is_negative(rhs.m_numerator), magnitude(rhs.m_numerator), wide_type(rhs.m_denominator));
         }
 
         /// Does calculate the sum of two fractions like \f$\frac{1}{2}-\frac{2}{3}=\frac{-1}{6}\f$
         /// @return difference of two fractions
-        constexpr friend fraction operator - (const fraction& lhs, const fraction& rhs) noexcept {
-            return fraction(lhs.get_numerator() * rhs.get_denominator() -
-                            lhs.get_denominator() * rhs.get_numerator(),
-                            lhs.get_denominator() * rhs.get_denominator());
+        /// @throw std::overflow_error when the result does not fit into T
+        constexpr friend fraction operator - (const fraction& lhs, const fraction& rhs) {
+            return add(is_negative(lhs.m_numerator), magnitude(lhs.m_numerator), wide_type(lhs.m_denominator),
+                       !is_negative(rhs.m_numerator), magnitude(rhs.m_numerator), wide_type(rhs.m_denominator));
         }
 
-        /// Does calculate the sum of two fractions like \f$\frac{1}{2}*\frac{2}{3}=\frac{2}{6}\f$
+        /// Does calculate the sum of two fractions like \f$\frac{1}{2}*\frac{2}{3}=\frac{1}{3}\f$
         /// @return product of two fractions
-        constexpr friend fraction operator * (const fraction& lhs, const fraction& rhs) noexcept {
-            return fraction(lhs.get_numerator() * rhs.get_numerator(),
-                            lhs.get_denominator() * rhs.get_denominator());
+        /// @throw std::overflow_error when the result does not fit into T
+        constexpr friend fraction operator * (const fraction& lhs, const fraction& rhs) {
+            return make(is_negative(lhs.m_numerator) != is_negative(rhs.m_numerator),
+                        magnitude(lhs.m_numerator) * magnitude(rhs.m_numerator),
+                        wide_type(lhs.m_denominator) * wide_type(rhs.m_denominator));
         }
 
         /// Does calculate the sum of two fractions like \f$\frac{1}{2}/\frac{2}{3}=\frac{3}{4}\f$
         /// @return division of two fractions
-        constexpr friend fraction operator / (const fraction& lhs, const fraction& rhs) noexcept {
-            return fraction(lhs.get_numerator() * rhs.get_denominator(),
-                            lhs.get_denominator() * rhs.get_numerator());
+        /// @throw std::runtime_error when rhs is 0
+        /// @throw std::overflow_error when the result does not fit into T
+        constexpr friend fraction operator / (const fraction& lhs, const fraction& rhs) {
+            return make(is_negative(lhs.m_numerator) != is_negative(rhs.m_numerator),
+                        magnitude(lhs.m_numerator) * wide_type(rhs.m_denominator),
+                        wide_type(lhs.m_denominator) * magnitude(rhs.m_numerator));
         }
 
-        /// compares two fractions on to be equal
-        friend bool operator == (const fraction& lhs, const fraction& rhs) noexcept {
-            if (lhs.get_denominator() == rhs.get_denominator()) {
-                return lhs.get_numerator() == rhs.get_numerator();
-            }
-
-            return lhs.get_numerator() * rhs.get_denominator() ==
-                   rhs.get_numerator() * lhs.get_denominator();
+        /// compares two fractions on to be equal (both are reduced)
+        constexpr friend bool operator == (const fraction& lhs, const fraction& rhs) noexcept {
+            return lhs.m_numerator == rhs.m_numerator && lhs.m_denominator == rhs.m_denominator;
         }
 
         /// dumping fraction to stream
@@ -96,13 +127,250 @@ class fraction final {
             return stream;
         }
 
+        /// Binary gcd (Stein): the factors 2 are removed by counting the trailing
+        /// zeros and the smaller odd value is subtracted from the bigger one.
+        /// @return greatest common divisor of given values (the other value when one is 0)
+        static constexpr wide_type gcd(const wide_type lhs, const wide_type rhs) noexcept {
+            return lhs == 0? rhs: rhs == 0? lhs
+                : odd_gcd(lhs >> trailing_zeros(lhs), rhs >> trailing_zeros(rhs)) << trailing_zeros(lhs | rhs);
+        }
+
     private:
+        /// tag for the c'tor of an already reduced fraction
+        struct reduced_tag {};
+
+        /// init c'tor for a reduced fraction
+        constexpr fraction(reduced_tag, const T numerator, const T denominator) noexcept
+            : m_numerator(numerator), m_denominator(denominator) {
+        }
+
+        /// @return reduced fraction for given sign and magnitudes
+        static constexpr fraction make(const bool negative, const wide_type numerator, const wide_type denominator) {
+            return denominator == 0? throw std::runtime_error("denominator of a fraction is 0")
+                : make(negative && numerator != 0, numerator, denominator, gcd(numerator, denominator));
+        }
+
+        /// @return fraction for given sign and magnitudes divided by their gcd
+        static constexpr fraction make(const bool negative, const wide_type numerator,
+                                       const wide_type denominator, const wide_type divisor) {
+            return numerator / divisor <= limit(negative) && denominator / divisor <= limit(false)
+                ? fraction(reduced_tag(), value(negative, numerator / divisor), static_cast<T>(denominator / divisor))
+                : throw std::overflow_error("fraction does not fit into the value type");
+        }
+
+        /// @return sum of two fractions given by signs and magnitudes
+        static constexpr fraction add(const bool lhs_negative, const wide_type lhs_numerator,
+                                      const wide_type lhs_denominator, const bool rhs_negative,
+                                      const wide_type rhs_numerator, const wide_type rhs_denominator) {
+            return add(lhs_negative, lhs_numerator, lhs_denominator, rhs_negative, rhs_numerator, rhs_denominator,
+                       gcd(lhs_denominator, rhs_denominator));
+        }
+
+        /// @return sum of two fractions extended to the least common denominator
+        static constexpr fraction add(const bool lhs_negative, const wide_type lhs_numerator,
+                                      const wide_type lhs_denominator, const bool rhs_negative,
+                                      const wide_type rhs_numerator, const wide_type rhs_denominator,
+                                      const wide_type divisor) {
+            return add(lhs_negative, lhs_numerator * (rhs_denominator / divisor),
+                       rhs_negative, rhs_numerator * (lhs_denominator / divisor),
+                       lhs_denominator / divisor * rhs_denominator);
+        }
+
+        /// @return sum of two numerators with same denominator
+        static constexpr fraction add(const bool lhs_negative, const wide_type lhs_numerator,
+                                      const bool rhs_negative, const wide_type rhs_numerator,
+                                      const wide_type denominator) {
+            return lhs_negative == rhs_negative
+                ? (lhs_numerator + rhs_numerator < lhs_numerator
+                   ? throw std::overflow_error("fraction does not fit into the value type")
+                   : make(lhs_negative, lhs_numerator + rhs_numerator, denominator))
+                : lhs_numerator >= rhs_numerator
+                ? make(lhs_negative, lhs_numerator - rhs_numerator, denominator)
+                : make(rhs_negative, rhs_numerator - lhs_numerator, denominator);
+        }
+
+        /// @return gcd of two odd values
+        static constexpr wide_type odd_gcd(const wide_type lhs, const wide_type rhs) noexcept {
+            return lhs == rhs? lhs
+                : lhs > rhs? odd_gcd((lhs - rhs) >> trailing_zeros(lhs - rhs), rhs)
+                : odd_gcd(lhs, (rhs - lhs) >> trailing_zeros(rhs - lhs));
+        }
+
+        /// @return number of trailing zero bits of a value not being 0
+        static constexpr uint32_t trailing_zeros(const wide_type value) noexcept {
+            return static_cast<uint64_t>(value) != 0? types::count_trailing_zeros(static_cast<uint64_t>(value))
+                : 64 + types::count_trailing_zeros(static_cast<uint64_t>((value >> 32) >> 32));
+        }
+
+        /// @return true when given value is below 0
+        static constexpr bool is_negative(const T value) noexcept {
+            return is_negative(value, std::is_signed<T>());
+        }
+
+        /// @return true when given signed value is below 0
+        static constexpr bool is_negative(const T value, std::true_type) noexcept {
+            return value < 0;
+        }
+
+        /// @return false (unsigned value)
+        static constexpr bool is_negative(const T, std::false_type) noexcept {
+            return false;
+        }
+
+        /// @return absolute value (also for the minimum of a signed type)
+        static constexpr wide_type magnitude(const T value) noexcept {
+            return is_negative(value)? wide_type(-(value + 1)) + 1: wide_type(value);
+        }
+
+        /// @return value of T for given sign and magnitude (fitting into T)
+        static constexpr T value(const bool negative, const wide_type magnitude) noexcept {
+            return negative? static_cast<T>(-static_cast<T>(magnitude - 1) - 1): static_cast<T>(magnitude);
+        }
+
+        /// @return biggest magnitude of T for given sign
+        static constexpr wide_type limit(const bool negative) noexcept {
+            return !negative? wide_type(std::numeric_limits<T>::max())
+                : std::is_signed<T>::value? wide_type(std::numeric_limits<T>::max()) + 1: 0;
+        }
+
         /// value above the line (or before the slash)
         T m_numerator;
         /// value below the line (or after the slash)
         T m_denominator;
 };
 
+/// @class fraction<big_integer>
+/// @brief non-negative fraction of big integers.
+///
+/// Numerator and denominator are kept as base 10^9 limbs (@ref detail::decimal_limbs)
+/// and reduced with the binary gcd. Sums are extended to the least common
+/// denominator only and the remaining common factor is found with the gcd of
+/// the numerator and the gcd of the denominators (Knuth); products are
+/// reduced crosswise before multiplying.
+template <>
+class fraction<big_integer> final {
+    public:
+        /// type of numerator and denominator
+        using value_type = big_integer;
+        /// base 10^9 digits (least significant first)
+        using limbs_type = detail::decimal_limbs::limbs_type;
+
+        /// init c'tor (reducing the fraction)
+        /// @throw std::runtime_error when the denominator is 0
+        fraction(const big_integer& numerator, const big_integer& denominator)
+            : m_numerator(detail::decimal_limbs::from_big_integer(numerator))
+            , m_denominator(detail::decimal_limbs::from_big_integer(denominator)) {
+            if (m_denominator.empty()) {
+                throw std::runtime_error("denominator of a fraction is 0");
+            }
+
+            const auto divisor = detail::decimal_limbs::gcd(m_numerator, m_denominator);
+            m_numerator = divide(m_numerator, divisor);
+            m_denominator = divide(m_denominator, divisor);
+        }
+
+        /// value above the line (or before the slash)
+        /// @return numerator as big integer
+        big_integer get_numerator() const {
+            return detail::decimal_limbs::to_big_integer(m_numerator);
+        }
+
+        /// value below the line (or after the slash)
+        /// @return denominator as big integer
+        big_integer get_denominator() const {
+            return detail::decimal_limbs::to_big_integer(m_denominator);
+        }
+
+        /// @return sum of two fractions
+        friend fraction operator + (const fraction& lhs, const fraction& rhs) {
+            return add(lhs, rhs, false);
+        }
+
+        /// @return difference of two fractions
+        /// @throw std::runtime_error when rhs is bigger than lhs
+        friend fraction operator - (const fraction& lhs, const fraction& rhs) {
+            return add(lhs, rhs, true);
+        }
+
+        /// @return product of two fractions
+        friend fraction operator * (const fraction& lhs, const fraction& rhs) {
+            return multiply(lhs.m_numerator, lhs.m_denominator, rhs.m_numerator, rhs.m_denominator);
+        }
+
+        /// @return division of two fractions
+        /// @throw std::runtime_error when rhs is 0
+        friend fraction operator / (const fraction& lhs, const fraction& rhs) {
+            if (rhs.m_numerator.empty()) {
+                throw std::runtime_error("denominator of a fraction is 0");
+            }
+            return multiply(lhs.m_numerator, lhs.m_denominator, rhs.m_denominator, rhs.m_numerator);
+        }
+
+        /// compares two fractions on to be equal (both are reduced)
+        friend bool operator == (const fraction& lhs, const fraction& rhs) noexcept {
+            return lhs.m_numerator == rhs.m_numerator && lhs.m_denominator == rhs.m_denominator;
+        }
+
+        /// dumping fraction to stream
+        friend std::ostream& operator << (std::ostream& stream, const fraction& f) {
+            stream << "fraction(";
+            detail::decimal_limbs::write(stream, f.m_numerator) << ", ";
+            detail::decimal_limbs::write(stream, f.m_denominator) << ")";
+            return stream;
+        }
+
+    private:
+        /// the sum of many fractions delays the reduction (@ref fraction_sum)
+        friend class fraction_sum<big_integer>;
+
+        /// init c'tor for a reduced fraction
+        fraction(limbs_type&& numerator, limbs_type&& denominator) noexcept
+            : m_numerator(std::move(numerator)), m_denominator(std::move(denominator)) {
+        }
+
+        /// @return value / divisor (divisor is a divisor of value)
+        static limbs_type divide(const limbs_type& value, const limbs_type& divisor) {
+            return divisor.size() == 1 && divisor[0] == 1? value: detail::decimal_limbs::divide(value, divisor);
+        }
+
+        /// @return sum or difference of two fractions
+        static fraction add(const fraction& lhs, const fraction& rhs, const bool subtract) {
+            // a/b + c/d = (a * d' + c * b') / (b' * d) with b = b' * g, d = d' * g
+            const auto divisor = detail::decimal_limbs::gcd(lhs.m_denominator, rhs.m_denominator);
+            const auto lhs_numerator = detail::decimal_limbs::multiply(lhs.m_numerator,
+                                                                       divide(rhs.m_denominator, divisor));
+            const auto rhs_numerator = detail::decimal_limbs::multiply(rhs.m_numerator,
+                                                                       divide(lhs.m_denominator, divisor));
+            if (subtract && detail::decimal_limbs::compare(lhs_numerator, rhs_numerator) < 0) {
+                throw std::runtime_error("difference of the fractions is negative");
+            }
+            const auto numerator = subtract? detail::decimal_limbs::subtract(lhs_numerator, rhs_numerator)
+                                           : detail::decimal_limbs::add(lhs_numerator, rhs_numerator);
+            if (numerator.empty()) {
+                return fraction(limbs_type(), limbs_type(1, 1));
+            }
+
+            // a common factor of the numerator and b' * d is a factor of g
+            const auto rest = detail::decimal_limbs::gcd(numerator, divisor);
+            return fraction(divide(numerator, rest),
+                            detail::decimal_limbs::multiply(divide(lhs.m_denominator, divisor),
+                                                            divide(rhs.m_denominator, rest)));
+        }
+
+        /// @return (a * c) / (b * d) reducing a with d and c with b first
+        static fraction multiply(const limbs_type& a, const limbs_type& b, const limbs_type& c, const limbs_type& d) {
+            const auto first = detail::decimal_limbs::gcd(a, d);
+            const auto second = detail::decimal_limbs::gcd(c, b);
+            return fraction(detail::decimal_limbs::multiply(divide(a, first), divide(c, second)),
+                            detail::decimal_limbs::multiply(divide(b, second), divide(d, first)));
+        }
+
+        /// value above the line (or before the slash)
+        limbs_type m_numerator;
+        /// value below the line (or after the slash)
+        limbs_type m_denominator;
+};
+
 }  // namespace math
 
 #endif  // INCLUDE_MATH_FRACTION_H_
@@ -0,0 +1,171 @@
+///
+/// @author  Thomas Lehmann
+/// @file    isqrt.h
+/// @brief   exact integer square root and test for squares
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_ISQRT_H_
+#define INCLUDE_MATH_ISQRT_H_
+
+#include <math/decimal_limbs.h>
+#include <type_traits>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace math {
+
+/// type for values up to 128 bit (for example \f$24 \cdot n + 1\f$ of 64 bit values)
+__extension__ typedef unsigned __int128 uint128_type;
+
+/// @return bits for the squares modulo given modulus (bit r is set when r is a square modulo m, m <= 64)
+constexpr uint64_t square_residues(const uint64_t modulus, const uint64_t value = 0) noexcept {
+    return value == modulus? 0: (uint64_t(1) << (value * value % modulus)) | square_residues(modulus, value + 1);
+}
+
+/// Fast rejection of non-squares by the squares modulo 64, 63, 11, 13, 17 and 19
+/// (without any square root). About 99.6% of the non-squares are rejected.
+/// @param value value to check or any value with same remainder modulo 64 * 2909907
+/// @return false when given value is no square (true means it might be one)
+inline bool may_be_square(const uint64_t value) noexcept {
+    constexpr auto mod_64 = square_residues(64);
+    constexpr auto mod_63 = square_residues(63);
+    constexpr auto mod_11 = square_residues(11);
+    constexpr auto mod_13 = square_residues(13);
+    constexpr auto mod_17 = square_residues(17);
+    constexpr auto mod_19 = square_residues(19);
+
+    if (((mod_64 >> (value & 63)) & 1) == 0) {
+        return false;
+    }
+
+    // 63 * 11 * 13 * 17 * 19
+    const auto rest = static_cast<uint32_t>(value % 2909907);
+    return ((mod_63 >> (rest % 63)) & (mod_11 >> (rest % 11)) & (mod_13 >> (rest % 13))
+            & (mod_17 >> (rest % 17)) & (mod_19 >> (rest % 19)) & 1) == 1;
+}
+
+/// @return given value as unsigned 64 bit value (negative values are 0; signed version)
+template <typename T>
+inline uint64_t non_negative_u64(const T value, std::true_type) noexcept {
+    return value < 0? 0: static_cast<uint64_t>(value);
+}
+
+/// @return given value as unsigned 64 bit value (unsigned version)
+template <typename T>
+inline uint64_t non_negative_u64(const T value, std::false_type) noexcept {
+    return static_cast<uint64_t>(value);
+}
+
+/// Biggest integer r with \f$r^2 \le value\f$. The root of the double is
+/// corrected by integer arithmetic so the result is exact for all 64 bit values.
+/// @param value value for which to calculate the root (negative values give 0)
+/// @return integer square root
+template <typename T>
+inline T isqrt(const T value) noexcept {
+    static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(uint64_t), "isqrt requires an integer <= 64 bit");
+    const auto number = non_negative_u64(value, std::is_signed<T>());
+    const auto max_root = uint64_t(0xffffffff);
+    auto root = std::min(static_cast<uint64_t>(std::sqrt(static_cast<double>(number))), max_root);
+    while (root * root > number) {
+        --root;
+    }
+    while (root < max_root && (root + 1) * (root + 1) <= number) {
+        ++root;
+    }
+    return static_cast<T>(root);
+}
+
+/// @param value value for which to calculate the root
+/// @return biggest integer r with \f$r^2 \le value\f$
+inline uint64_t isqrt(const uint128_type value) noexcept {
+    if ((value >> 64) == 0) {
+        return isqrt(static_cast<uint64_t>(value));
+    }
+
+    // the root of the double (clamped: it may be rounded up to 2^64) is exact in the upper 52 bits;
+    // one step of Newton's iteration leaves an error of a few units at most
+    const auto max_root = UINT64_MAX;
+    const auto estimate = std::sqrt(static_cast<double>(value));
+    auto root = estimate >= static_cast<double>(max_root)? max_root: static_cast<uint64_t>(estimate);
+    root = static_cast<uint64_t>(std::min((root + value / root) / 2, static_cast<uint128_type>(max_root)));
+    while (static_cast<uint128_type>(root) * root > value) {
+        --root;
+    }
+    while (root < max_root && static_cast<uint128_type>(root + 1) * (root + 1) <= value) {
+        ++root;
+    }
+    return root;
+}
+
+/// Biggest integer r with \f$r^2 \le value\f$ for a big integer
+/// (see @ref detail::decimal_limbs::square_root: Newton's iteration for the
+/// reciprocal square root with multiplications only).
+/// @param value value for which to calculate the root
+/// @return integer square root
+inline big_integer isqrt(const big_integer& value) {
+    return detail::decimal_limbs::to_big_integer(
+        detail::decimal_limbs::square_root(detail::decimal_limbs::from_big_integer(value)));
+}
+
+/// @param value value to check (negative values are no squares)
+/// @return true when given value is a square like 9 (3 * 3)
+template <typename T>
+inline bool is_square(const T value) noexcept {
+    static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(uint64_t),
+                  "is_square requires an integer <= 64 bit");
+    const auto number = non_negative_u64(value, std::is_signed<T>());
+    // negative values are mapped to 0
+    if (number != static_cast<uint64_t>(value) || !may_be_square(number)) {
+        return false;
+    }
+    const auto root = isqrt(number);
+    return root * root == number;
+}
+
+/// @param value value to check
+/// @return true when given value is a square
+inline bool is_square(const uint128_type value) noexcept {
+    if (!may_be_square(static_cast<uint64_t>(value % (uint64_t(64) * 2909907)))) {
+        return false;
+    }
+    const auto root = isqrt(value);
+    return static_cast<uint128_type>(root) * root == value;
+}
+
+/// @param value value to check
+/// @return true when given big integer is a square
+inline bool is_square(const big_integer& value) {
+    const auto number = detail::decimal_limbs::from_big_integer(value);
+    auto rest = uint64_t(0);
+    for (auto index = number.size(); index > 0; --index) {
+        rest = (rest * detail::decimal_limbs::BASE + number[index - 1]) % (uint64_t(64) * 2909907);
+    }
+    if (!may_be_square(rest)) {
+        return false;
+    }
+
+    const auto root = detail::decimal_limbs::square_root(number);
+    return detail::decimal_limbs::compare(detail::decimal_limbs::multiply(root, root), number) == 0;
+}
+
+}  // namespace math
+
+#endif  // INCLUDE_MATH_ISQRT_H_
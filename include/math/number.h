@@ -24,10 +24,15 @@
 #define INCLUDE_MATH_NUMBER_H_
 
 #include <math/factorization.h>
+#include <math/divisor_sum_sieve.h>
 #include <math/digits.h>
+#include <math/isqrt.h>
+#include <type_traits>
 #include <algorithm>
-#include <numeric>
-#include <cmath>
+#include <functional>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 namespace math {
 
@@ -36,29 +41,60 @@ template <typename T>
 struct number final {
     /// Checks a number to be perfect; 6 is the first one (1+2+3=6 which is equal to 6).
     /// @return true when the sum of the divisors of the given number is equal to the number
-    /// @note that function is very performance intensive and the numbers grow very fast!
+    /// @note the numbers grow very fast!
     /// @see http://en.wikipedia.org/wiki/Perfect_number
     /// @see here: oeis.org/A000396
     inline static bool is_perfect(const T number) noexcept {
-        typename factorization<T>::container_type divisors;
-        factorization<T>::probe(number, divisors);
-        return (std::accumulate(divisors.begin(), divisors.end(), 0) - number) == number;
+        return compare_proper_divisors(number) == 0;
     }
 
     /// Checks a number to be abundant; 12 is the first one (1+2+3+4+6=16 which is greater than 12).
     /// @return true when the sum of the divisors of the given number is greater as the number
     /// @see http://en.wikipedia.org/wiki/Abundant_number
+    /// @note 0 is abundant: the sum of its "divisors" 1 and 0 is 1 (see @ref factorization::probe)
     inline static bool is_abundant(const T number) noexcept {
-        typename factorization<T>::container_type divisors;
-        factorization<T>::probe(number, divisors);
-        return (std::accumulate(divisors.begin(), divisors.end(), 0) - number) > number;
+        return compare_proper_divisors(number) > 0;
+    }
+
+    /// Checks a number to be deficient; 1 is the first one (sum of proper divisors 0 is less than 1).
+    /// @return true when the sum of the divisors of the given number is less than the number
+    /// @see http://en.wikipedia.org/wiki/Deficient_number
+    inline static bool is_deficient(const T number) noexcept {
+        return compare_proper_divisors(number) < 0;
+    }
+
+    /// Checks all numbers of the range [first, last] to be perfect.
+    /// @param sieve calculated sieve with sieve.max_number() >= last
+    /// @param results [out] one state for each number of the range (index 0 for first)
+    template <typename S>
+    inline static void is_perfect(const divisor_sum_sieve<S>& sieve, const T first, const T last,
+                                  std::vector<bool>& results) {
+        classify(sieve, first, last, results, std::equal_to<S>());
+    }
+
+    /// Checks all numbers of the range [first, last] to be abundant.
+    /// @param sieve calculated sieve with sieve.max_number() >= last
+    /// @param results [out] one state for each number of the range (index 0 for first)
+    template <typename S>
+    inline static void is_abundant(const divisor_sum_sieve<S>& sieve, const T first, const T last,
+                                   std::vector<bool>& results) {
+        classify(sieve, first, last, results, std::greater<S>());
+    }
+
+    /// Checks all numbers of the range [first, last] to be deficient.
+    /// @param sieve calculated sieve with sieve.max_number() >= last
+    /// @param results [out] one state for each number of the range (index 0 for first)
+    template <typename S>
+    inline static void is_deficient(const divisor_sum_sieve<S>& sieve, const T first, const T last,
+                                    std::vector<bool>& results) {
+        classify(sieve, first, last, results, std::less<S>());
     }
 
     /// Checks a number to be square like 9 (which is - of course - 3*3).
+    /// Most non-squares are rejected by their remainders without any root (see @ref math::may_be_square).
     /// @return true when given number is a square
     inline static bool is_square(const T number) noexcept {
-        const auto value = sqrt(number);
-        return value == static_cast<T>(value);
+        return math::is_square(number);
     }
 
     /// <i>n</i>th triangle number can be calculated by this formula:
@@ -75,7 +111,7 @@ struct number final {
     /// @return true when given number is a triangle number
     /// @see http://en.wikipedia.org/wiki/Triangular_number
     inline static bool is_triangle(const T number) noexcept {
-        return is_square(8 * number + 1);
+        return is_figurate(number, 8, 2, 1);
     }
 
     /// <i>n</i>th pentagonal number can be calculated by this formula:
@@ -89,11 +125,11 @@ struct number final {
 
     /// Testing for being a pentagonal number can be calculated by this formula:
     /// \f$n = \frac{\sqrt{24 \cdot x + 1} + 1}{6}\f$
+    /// When the root is an integer r with \f$r \equiv 5 \pmod{6}\f$ then it is a pentagonal number.
     /// @return true when given number is a pentagonal number
     /// @see http://en.wikipedia.org/wiki/Triangular_number
     inline static bool is_pentagonal(const T number) noexcept {
-        const auto value = (sqrt(24 * number + 1) + 1) / 6.0;
-        return value > 0 && value == static_cast<T>(value);
+        return is_figurate(number, 24, 6, 5);
     }
 
     /// <i>n</i>th hexagonal number can be calculated by this formula: \f$h_n = n \cdot (2 \cdot n - 1)\f$
@@ -106,13 +142,52 @@ struct number final {
 
     /// Testing for being a hexagonal number can be calculated by this formula:
     /// \f$n = \frac{\sqrt{8 \cdot x + 1} + 1}{4}\f$
-    /// When the result is an integer value then it is a hexagonal number.
+    /// When the root is an integer r with \f$r \equiv 3 \pmod{4}\f$ then it is a hexagonal number.
     ///
     /// @return true when given number is a hexagonal number
     /// @see http://en.wikipedia.org/wiki/Hexagonal_number
     inline static bool is_hexagonal(const T number) noexcept {
-        const auto value = (sqrt(8 * number + 1) + 1) / 4.0;
-        return value == static_cast<T>(value);
+        return is_figurate(number, 8, 4, 3);
+    }
+
+    /// Checking a range of numbers for being squares.
+    /// @param numbers pointer to first number
+    /// @param count number of numbers
+    /// @param results one entry per number (1 when square otherwise 0)
+    inline static void is_square_batch(const T* numbers, const std::size_t count, uint8_t* results) noexcept {
+        for (auto index = std::size_t(0); index < count; ++index) {
+            results[index] = is_square(numbers[index])? 1: 0;
+        }
+    }
+
+    /// Checking a range of numbers for being triangle numbers.
+    /// @param numbers pointer to first number
+    /// @param count number of numbers
+    /// @param results one entry per number (1 when triangle number otherwise 0)
+    inline static void is_triangle_batch(const T* numbers, const std::size_t count, uint8_t* results) noexcept {
+        for (auto index = std::size_t(0); index < count; ++index) {
+            results[index] = is_triangle(numbers[index])? 1: 0;
+        }
+    }
+
+    /// Checking a range of numbers for being pentagonal numbers.
+    /// @param numbers pointer to first number
+    /// @param count number of numbers
+    /// @param results one entry per number (1 when pentagonal number otherwise 0)
+    inline static void is_pentagonal_batch(const T* numbers, const std::size_t count, uint8_t* results) noexcept {
+        for (auto index = std::size_t(0); index < count; ++index) {
+            results[index] = is_pentagonal(numbers[index])? 1: 0;
+        }
+    }
+
+    /// Checking a range of numbers for being hexagonal numbers.
+    /// @param numbers pointer to first number
+    /// @param count number of numbers
+    /// @param results one entry per number (1 when hexagonal number otherwise 0)
+    inline static void is_hexagonal_batch(const T* numbers, const std::size_t count, uint8_t* results) noexcept {
+        for (auto index = std::size_t(0); index < count; ++index) {
+            results[index] = is_hexagonal(numbers[index])? 1: 0;
+        }
     }
 
     /// @copydoc @ref math::digits::is_pandigital
@@ -129,6 +204,75 @@ struct number final {
     inline static T reverse(const T number) noexcept {
         return digits<T>::reverse(number);
     }
+
+    private:
+    /// Compares the sum of the proper divisors (calculated with 64 bit) with the number.
+    /// @return -1, 0 or 1 when the sum is less than, equal to or greater than the number
+    /// @note the sum is 1 for numbers < 1 (see @ref factorization::sum_of_divisors)
+    inline static int compare_proper_divisors(const T number) noexcept {
+        if (number < 1) {
+            return 1;
+        }
+
+        const auto value = static_cast<uint64_t>(number);
+        const auto sum = factorization<T>::sum_of_divisors(number) - value;
+        return (sum > value) - (sum < value);
+    }
+
+    /// Compares the sum of the proper divisors with the number for all numbers of
+    /// the range [first, last] (the sum is 1 for 0 like in @ref compare_proper_divisors).
+    /// @param sieve calculated sieve with sieve.max_number() >= last
+    /// @param results [out] one state for each number of the range (index 0 for first)
+    /// @param compare called as compare(sum of proper divisors, number)
+    template <typename S, typename F>
+    inline static void classify(const divisor_sum_sieve<S>& sieve, const T first, const T last,
+                                std::vector<bool>& results, const F compare) {
+        results.clear();
+        if (last < first) {
+            return;
+        }
+
+        // counting the offset up to last - first only (last may be the biggest value of T)
+        const auto count = static_cast<uint64_t>(last) - static_cast<uint64_t>(first);
+        results.reserve(static_cast<std::size_t>(count + 1));
+        for (auto offset = uint64_t(0); ; ++offset) {
+            const auto number = static_cast<uint64_t>(first) + offset;
+            const auto sum = number == 0? S(1): sieve.sum_of_proper_divisors(number);
+            results.push_back(compare(sum, static_cast<S>(number)));
+            if (offset == count) {
+                break;
+            }
+        }
+    }
+
+    /// Checks the number \f$m \cdot x + 1\f$ to be the square of an integer r with
+    /// \f$r \equiv remainder \pmod{modulus}\f$ (exact for all values of T; the value
+    /// is calculated with 128 bit when it does not fit into 64 bit).
+    /// @param number the number x to check (negative numbers fail)
+    /// @param multiplier the factor m
+    /// @param modulus modulus for the root
+    /// @param remainder required remainder of the root
+    /// @return true when the condition is fulfilled
+    inline static bool is_figurate(const T number, const uint64_t multiplier,
+                                   const uint64_t modulus, const uint64_t remainder) noexcept {
+        const auto value = non_negative_u64(number, std::is_signed<T>());
+        if (value != static_cast<uint64_t>(number)) {
+            return false;
+        }
+
+        if (value <= (UINT64_MAX - 1) / multiplier) {
+            const auto square = multiplier * value + 1;
+            if (!may_be_square(square)) {
+                return false;
+            }
+            const auto root = isqrt(square);
+            return root * root == square && root % modulus == remainder;
+        }
+
+        const auto square = static_cast<uint128_type>(multiplier) * value + 1;
+        const auto root = isqrt(square);
+        return static_cast<uint128_type>(root) * root == square && root % modulus == remainder;
+    }
 };
 
 }  // namespace math
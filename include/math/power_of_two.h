@@ -23,6 +23,8 @@
 #ifndef INCLUDE_MATH_POWER_OF_TWO_H_
 #define INCLUDE_MATH_POWER_OF_TWO_H_
 
+#include <math/decimal_limbs.h>
+
 #include <iostream>
 #include <vector>
 #include <cstdint>
@@ -31,57 +33,85 @@ namespace math {
 
 /// @class power_of_two
 /// @brief math 2^x function.
+///
+/// The value is kept as base 10^9 digits (@ref detail::decimal_limbs). A calculation
+/// close to the previous exponent doubles (or halves) the previous value
+/// by up to 29 bits per pass; otherwise the value is the product of the
+/// squares \f$2^{2^i}\f$ for the bits of the exponent which are kept
+/// (memoised) for further calculations.
+///
+/// @code
+/// math::power_of_two pot;
+/// pot.calculate(1000000);   // squares
+/// pot.calculate(1000001);   // one doubling
+/// std::cout << pot;         // 301030 digits, written without copy
+/// @endcode
 class power_of_two final {
     public:
-        /// type representing smallest type for one digit
-        using digit = unsigned char;
-        /// type for container of digits
-        using container = std::vector<digit>;
+        /// biggest difference of exponents for doubling or halving the previous value
+        enum {INCREMENTAL_LIMIT = 2048};
 
-        /// initializing defaults
+        /// initializing with 2^0
         power_of_two()
-            : m_digits() {}
+            : m_exponent(0), m_limbs(1, 1), m_squares(1, detail::decimal_limbs::limbs_type(1, 2)) {}
 
         /// does the calculation of 2^x.
-        void calculate(uint32_t exponent) noexcept {
-            reset();
-            while (exponent > 0) {
-                auto index = static_cast<uint32_t>(0);
-                auto rest = static_cast<digit>(0);
-
-                while (index < m_digits.size()) {
-                    auto value = m_digits[index] * 2 + rest;
-                    m_digits[index] = value % 10;
-                    rest = value / 10;
-                    ++index;
-                }
-
-                if (rest > 0) {
-                    m_digits.push_back(rest);
-                }
-                --exponent;
+        /// @throw std::bad_alloc when the limbs or the memoised squares cannot be allocated
+        ///        (no noexcept anymore; before, a failing push_back called std::terminate)
+        void calculate(const uint32_t exponent) {
+            if (exponent >= m_exponent && exponent - m_exponent <= INCREMENTAL_LIMIT) {
+                detail::decimal_limbs::double_in_place(m_limbs, exponent - m_exponent);
+            } else if (exponent < m_exponent && m_exponent - exponent <= INCREMENTAL_LIMIT) {
+                detail::decimal_limbs::halve_in_place(m_limbs, m_exponent - exponent);
+            } else {
+                m_limbs = by_squares(exponent);
             }
+            m_exponent = exponent;
+        }
+
+        /// @return exponent of the current value
+        uint32_t exponent() const noexcept {
+            return m_exponent;
         }
 
         /// @param stream is stream to write result to
         /// @param pot is the object with current result
         /// @return stream to continue write operations
         friend std::ostream& operator << (std::ostream& stream, const power_of_two& pot) {
-            for (int32_t index = pot.m_digits.size() - 1; index >= 0; --index) {
-                stream << static_cast<uint32_t>(pot.m_digits[index]);
-            }
-            return stream;
+            return detail::decimal_limbs::write(stream, pot.m_limbs);
         }
 
     private:
-        /// does reset the previous result
-        void reset() noexcept {
-            m_digits.clear();
-            m_digits.push_back(1);
+        /// lowest bits of an exponent which are done by doubling
+        enum {DOUBLING_BITS = 6};
+
+        /// @return 2^exponent as product of the squares 2^(2^i) for the bits i of the exponent
+        detail::decimal_limbs::limbs_type by_squares(const uint32_t exponent) {
+            detail::decimal_limbs::limbs_type result(1, 1);
+            for (auto bit = uint32_t(32); bit-- > DOUBLING_BITS; ) {
+                if ((exponent >> bit) & 1) {
+                    result = detail::decimal_limbs::multiply(result, square(bit));
+                }
+            }
+
+            detail::decimal_limbs::double_in_place(result, exponent & ((1 << DOUBLING_BITS) - 1));
+            return result;
+        }
+
+        /// @return 2^(2^nth) (calculating the missing squares)
+        const detail::decimal_limbs::limbs_type& square(const uint32_t nth) {
+            while (m_squares.size() <= nth) {
+                m_squares.push_back(detail::decimal_limbs::multiply(m_squares.back(), m_squares.back()));
+            }
+            return m_squares[nth];
         }
 
-        /// all calculated digits
-        container m_digits;
+        /// exponent of the current value
+        uint32_t m_exponent;
+        /// current value 2^exponent
+        detail::decimal_limbs::limbs_type m_limbs;
+        /// memoised squares 2^(2^i)
+        std::vector<detail::decimal_limbs::limbs_type> m_squares;
 };
 
 }  // namespace math
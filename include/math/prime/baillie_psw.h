@@ -0,0 +1,630 @@
+///
+/// @author  Thomas Lehmann
+/// @file    baillie_psw.h
+/// @brief   Baillie-PSW probable prime test for big integer
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_BAILLIE_PSW_H_
+#define INCLUDE_MATH_PRIME_BAILLIE_PSW_H_
+
+#include <math/big_integer.h>
+#include <math/prime/small_primes.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class baillie_psw
+/// @brief Baillie-PSW probable prime test for numbers of any size.
+///
+/// A number is a probable prime when it is a strong probable prime to base 2
+/// and a strong Lucas probable prime with the parameters of Selfridge. No
+/// composite number passing both tests is known. Most composites are rejected
+/// before by trial division with the primes below @ref TRIAL_DIVISION_LIMIT.
+///
+/// The decimal digits of a @ref math::big_integer are converted into 64 bit
+/// limbs once, the tests itself are using Montgomery multiplication.
+///
+/// @code
+/// // 2^127 - 1
+/// const math::big_integer number(...);
+/// const auto prime = math::prime::baillie_psw::is_probable_prime(number);  // true
+///
+/// // many candidates, checked by all cores
+/// std::vector<uint8_t> results(candidates.size());
+/// math::prime::baillie_psw::is_probable_prime_batch(candidates.data(), candidates.size(), results.data());
+/// @endcode
+///
+/// @see https://en.wikipedia.org/wiki/Baillie%E2%80%93PSW_primality_test
+class baillie_psw final {
+    public:
+        /// natural number as 64 bit limbs (least significant limb first, no leading zero limbs)
+        using limbs_type = std::vector<uint64_t>;
+
+        /// primes below this limit are used for trial division
+        enum {TRIAL_DIVISION_LIMIT = 4096};
+
+        /// no instances
+        baillie_psw() = delete;
+
+        /// @param number big integer to convert
+        /// @return given number as 64 bit limbs (empty for zero)
+        static limbs_type to_limbs(const big_integer& number) {
+            // 19 decimal digits always fit into 64 bit
+            const auto CHUNK_DIGITS = std::size_t(19);
+            const auto digits = number.to_string();
+
+            limbs_type limbs;
+            auto position = std::size_t(0);
+            while (position < digits.size()) {
+                const auto rest = (digits.size() - position) % CHUNK_DIGITS;
+                const auto length = rest == 0? CHUNK_DIGITS: rest;
+
+                auto chunk = uint64_t(0);
+                auto scale = uint64_t(1);
+                for (const auto end = position + length; position < end; ++position) {
+                    chunk = chunk * 10 + static_cast<uint64_t>(digits[position] - '0');
+                    scale *= 10;
+                }
+
+                // limbs = limbs * scale + chunk
+                auto carry = static_cast<wide_type>(chunk);
+                for (auto& limb: limbs) {
+                    const auto value = static_cast<wide_type>(limb) * scale + carry;
+                    limb = static_cast<uint64_t>(value);
+                    carry = value >> 64;
+                }
+
+                if (carry != 0) {
+                    limbs.push_back(static_cast<uint64_t>(carry));
+                }
+            }
+
+            return limbs;
+        }
+
+        /// @param number number to check
+        /// @return true when given number is a (probable) prime
+        static bool is_probable_prime(const big_integer& number) {
+            return is_probable_prime(to_limbs(number));
+        }
+
+        /// @param number number to check (no leading zero limbs)
+        /// @return true when given number is a (probable) prime
+        static bool is_probable_prime(const limbs_type& number) {
+            if (number.empty()) {
+                return false;
+            }
+
+            if (number.size() == 1 && number[0] < small_primes::LIMIT) {
+                return small_primes::is_prime(static_cast<uint32_t>(number[0]));
+            }
+
+            if (number[0] % 2 == 0 || has_small_factor(number)) {
+                return false;
+            }
+
+            if (number.size() == 1 && number[0] < uint64_t(TRIAL_DIVISION_LIMIT) * TRIAL_DIVISION_LIMIT) {
+                return true;
+            }
+
+            const montgomery arithmetic(number);
+            return is_strong_probable_prime(arithmetic)
+                && !is_square(number)
+                && is_strong_lucas_probable_prime(arithmetic);
+        }
+
+        /// Checking many numbers at once; the numbers are distributed
+        /// one by one to the threads since a check of a number with a small
+        /// factor is much faster than the check of a prime.
+        ///
+        /// @param numbers numbers to check (big_integer or limbs_type)
+        /// @param count number of numbers
+        /// @param results [out] 1 for a (probable) prime and 0 for a none prime for each number
+        /// @param threads number of threads to use (0 for one per core)
+        template <typename T>
+        static void is_probable_prime_batch(const T* numbers, const std::size_t count, uint8_t* results,
+                                            const std::size_t threads = 0) {
+            const auto wanted = threads == 0? static_cast<std::size_t>(std::thread::hardware_concurrency()): threads;
+            const auto workers_count = std::max(static_cast<std::size_t>(1), std::min(wanted, count));
+
+            std::atomic<std::size_t> next(0);
+            const auto work = [numbers, count, results, &next]() {
+                for (auto index = next++; index < count; index = next++) {
+                    results[index] = is_probable_prime(numbers[index])? 1: 0;
+                }
+            };
+
+            std::vector<std::thread> workers;
+            for (auto worker = static_cast<std::size_t>(1); worker < workers_count; ++worker) {
+                workers.emplace_back(work);
+            }
+
+            work();
+            for (auto& worker: workers) {
+                worker.join();
+            }
+        }
+
+    private:
+        /// type for the product of two limbs
+        __extension__ typedef unsigned __int128 wide_type;
+
+        /// @class montgomery
+        /// @brief arithmetic modulo an odd number with the values in Montgomery form (a * R mod n, R = 2^(64 * k)).
+        class montgomery final {
+            public:
+                /// @param modulus odd number > 1
+                explicit montgomery(const limbs_type& modulus)
+                    : m_modulus(modulus)
+                    , m_inverse(negated_inverse(modulus[0]))
+                    , m_zero(modulus.size(), 0)
+                    , m_one(modulus.size(), 0)
+                    , m_square(modulus.size(), 0)
+                    , m_scratch(modulus.size() + 2, 0) {
+                    // R mod n and R^2 mod n by doubling
+                    m_one[0] = 1;
+                    for (auto bit = std::size_t(0); bit < 64 * size(); ++bit) {
+                        add(m_one, m_one, m_one);
+                    }
+
+                    m_square = m_one;
+                    for (auto bit = std::size_t(0); bit < 64 * size(); ++bit) {
+                        add(m_square, m_square, m_square);
+                    }
+                }
+
+                /// @return number of limbs of each value
+                std::size_t size() const noexcept {
+                    return m_modulus.size();
+                }
+
+                /// @return the modulus
+                const limbs_type& modulus() const noexcept {
+                    return m_modulus;
+                }
+
+                /// @return 1 in Montgomery form
+                const limbs_type& one() const noexcept {
+                    return m_one;
+                }
+
+                /// @return 0 (same in Montgomery form)
+                const limbs_type& zero() const noexcept {
+                    return m_zero;
+                }
+
+                /// @param value small value with |value| < modulus
+                /// @return given value in Montgomery form
+                limbs_type to_montgomery(const int64_t value) const noexcept {
+                    limbs_type result(size(), 0);
+                    result[0] = value < 0? static_cast<uint64_t>(-value): static_cast<uint64_t>(value);
+                    multiply(result, m_square, result);
+                    if (value < 0) {
+                        subtract(m_zero, result, result);
+                    }
+                    return result;
+                }
+
+                /// result = lhs * rhs / R mod n (result may be lhs or rhs)
+                void multiply(const limbs_type& lhs, const limbs_type& rhs, limbs_type& result) const noexcept {
+                    const auto k = size();
+                    auto& t = m_scratch;
+                    std::fill(t.begin(), t.end(), 0);
+
+                    for (auto i = std::size_t(0); i < k; ++i) {
+                        // t = t + lhs * rhs[i]
+                        auto carry = uint64_t(0);
+                        for (auto j = std::size_t(0); j < k; ++j) {
+                            const auto value = static_cast<wide_type>(lhs[j]) * rhs[i] + t[j] + carry;
+                            t[j] = static_cast<uint64_t>(value);
+                            carry = static_cast<uint64_t>(value >> 64);
+                        }
+                        const auto top = static_cast<wide_type>(t[k]) + carry;
+                        t[k] = static_cast<uint64_t>(top);
+                        t[k + 1] = static_cast<uint64_t>(top >> 64);
+
+                        // t = (t + m * n) / 2^64 with m chosen so that the lowest limb gets zero
+                        const auto m = t[0] * m_inverse;
+                        carry = static_cast<uint64_t>((static_cast<wide_type>(m) * m_modulus[0] + t[0]) >> 64);
+                        for (auto j = std::size_t(1); j < k; ++j) {
+                            const auto value = static_cast<wide_type>(m) * m_modulus[j] + t[j] + carry;
+                            t[j - 1] = static_cast<uint64_t>(value);
+                            carry = static_cast<uint64_t>(value >> 64);
+                        }
+                        const auto rest = static_cast<wide_type>(t[k]) + carry;
+                        t[k - 1] = static_cast<uint64_t>(rest);
+                        t[k] = t[k + 1] + static_cast<uint64_t>(rest >> 64);
+                    }
+
+                    std::copy(t.begin(), t.begin() + static_cast<std::ptrdiff_t>(k), result.begin());
+                    if (t[k] != 0 || !less(result, m_modulus)) {
+                        subtract_in_place(result, m_modulus);
+                    }
+                }
+
+                /// result = lhs + rhs mod n (result may be lhs or rhs)
+                void add(const limbs_type& lhs, const limbs_type& rhs, limbs_type& result) const noexcept {
+                    auto carry = uint64_t(0);
+                    for (auto j = std::size_t(0); j < size(); ++j) {
+                        const auto value = static_cast<wide_type>(lhs[j]) + rhs[j] + carry;
+                        result[j] = static_cast<uint64_t>(value);
+                        carry = static_cast<uint64_t>(value >> 64);
+                    }
+
+                    if (carry != 0 || !less(result, m_modulus)) {
+                        subtract_in_place(result, m_modulus);
+                    }
+                }
+
+                /// result = lhs - rhs mod n (result may be lhs or rhs)
+                void subtract(const limbs_type& lhs, const limbs_type& rhs, limbs_type& result) const noexcept {
+                    auto borrow = uint64_t(0);
+                    for (auto j = std::size_t(0); j < size(); ++j) {
+                        const auto value = static_cast<wide_type>(lhs[j]) - rhs[j] - borrow;
+                        result[j] = static_cast<uint64_t>(value);
+                        borrow = static_cast<uint64_t>(value >> 64) & 1;
+                    }
+
+                    if (borrow != 0) {
+                        add_in_place(result, m_modulus);
+                    }
+                }
+
+                /// result = value / 2 mod n (result may be value)
+                void half(const limbs_type& value, limbs_type& result) const noexcept {
+                    auto carry = uint64_t(0);
+                    if (value[0] & 1) {
+                        result = value;
+                        carry = add_in_place(result, m_modulus);
+                    } else {
+                        result = value;
+                    }
+
+                    for (auto j = std::size_t(0); j < size(); ++j) {
+                        const auto high = j + 1 < size()? result[j + 1]: carry;
+                        result[j] = (result[j] >> 1) | (high << 63);
+                    }
+                }
+
+            private:
+                /// @return -1 / value mod 2^64 (value has to be odd)
+                static uint64_t negated_inverse(const uint64_t value) noexcept {
+                    // each Newton step doubles the number of correct bits (3 at the start)
+                    auto inverse = value;
+                    for (auto step = 0; step < 5; ++step) {
+                        inverse *= 2 - value * inverse;
+                    }
+                    return 0 - inverse;
+                }
+
+                /// the odd modulus n
+                limbs_type m_modulus;
+                /// -1 / n mod 2^64
+                uint64_t m_inverse;
+                /// 0
+                limbs_type m_zero;
+                /// R mod n
+                limbs_type m_one;
+                /// R^2 mod n
+                limbs_type m_square;
+                /// intermediate result of a multiplication (one instance per thread)
+                mutable limbs_type m_scratch;
+        };
+
+        /// @return true when lhs < rhs (both of same size)
+        static bool less(const limbs_type& lhs, const limbs_type& rhs) noexcept {
+            for (auto j = lhs.size(); j > 0; --j) {
+                if (lhs[j - 1] != rhs[j - 1]) {
+                    return lhs[j - 1] < rhs[j - 1];
+                }
+            }
+            return false;
+        }
+
+        /// value = value - other (the final borrow is ignored)
+        static void subtract_in_place(limbs_type& value, const limbs_type& other) noexcept {
+            auto borrow = uint64_t(0);
+            for (auto j = std::size_t(0); j < value.size(); ++j) {
+                const auto difference = static_cast<wide_type>(value[j]) - other[j] - borrow;
+                value[j] = static_cast<uint64_t>(difference);
+                borrow = static_cast<uint64_t>(difference >> 64) & 1;
+            }
+        }
+
+        /// value = value + other
+        /// @return final carry
+        static uint64_t add_in_place(limbs_type& value, const limbs_type& other) noexcept {
+            auto carry = uint64_t(0);
+            for (auto j = std::size_t(0); j < value.size(); ++j) {
+                const auto sum = static_cast<wide_type>(value[j]) + other[j] + carry;
+                value[j] = static_cast<uint64_t>(sum);
+                carry = static_cast<uint64_t>(sum >> 64);
+            }
+            return carry;
+        }
+
+        /// @return state of given bit
+        static bool bit(const limbs_type& number, const std::size_t position) noexcept {
+            return ((number[position / 64] >> (position % 64)) & 1) == 1;
+        }
+
+        /// @return number of bits without leading zero bits
+        static std::size_t bit_length(const limbs_type& number) noexcept {
+            auto length = 64 * number.size();
+            for (auto j = number.size(); j > 0 && number[j - 1] == 0; --j) {
+                length -= 64;
+            }
+            if (length > 0) {
+                for (auto top = number[length / 64 - 1]; (top >> 63) == 0; top <<= 1) {
+                    --length;
+                }
+            }
+            return length;
+        }
+
+        /// @return position of lowest bit set (number must not be zero)
+        static std::size_t lowest_bit(const limbs_type& number) noexcept {
+            auto position = std::size_t(0);
+            while (!bit(number, position)) {
+                ++position;
+            }
+            return position;
+        }
+
+        /// @return position of lowest bit set ignoring bit 0
+        static std::size_t lowest_bit_above_zero(const limbs_type& number) noexcept {
+            auto position = std::size_t(1);
+            while (!bit(number, position)) {
+                ++position;
+            }
+            return position;
+        }
+
+        /// @return number mod divisor
+        static uint64_t remainder(const limbs_type& number, const uint64_t divisor) noexcept {
+            auto rest = uint64_t(0);
+            for (auto it = number.rbegin(); it != number.rend(); ++it) {
+                rest = static_cast<uint64_t>(((static_cast<wide_type>(rest) << 64) | *it) % divisor);
+            }
+            return rest;
+        }
+
+        /// Trial division by the odd primes below TRIAL_DIVISION_LIMIT; the remainder for
+        /// a product of primes fitting into 64 bit gives the remainders of all those primes.
+        /// @return true when given number (> TRIAL_DIVISION_LIMIT) has a small odd prime factor
+        static bool has_small_factor(const limbs_type& number) noexcept {
+            auto nth = std::size_t(1);
+            while (small_primes::primes[nth] < TRIAL_DIVISION_LIMIT) {
+                const auto first = nth;
+                auto product = uint64_t(1);
+                while (small_primes::primes[nth] < TRIAL_DIVISION_LIMIT
+                       && product <= std::numeric_limits<uint64_t>::max() / small_primes::primes[nth]) {
+                    product *= small_primes::primes[nth++];
+                }
+
+                const auto rest = remainder(number, product);
+                for (auto index = first; index < nth; ++index) {
+                    if (rest % small_primes::primes[index] == 0) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /// @param number odd number
+        /// @return true when given number is a square (digit by digit root)
+        static bool is_square(const limbs_type& number) noexcept {
+            // odd squares are 1 mod 8
+            if ((number[0] & 7) != 1) {
+                return false;
+            }
+
+            limbs_type rest = number;
+            limbs_type root(number.size(), 0);
+            limbs_type candidate(number.size(), 0);
+            limbs_type power(number.size(), 0);
+
+            for (auto position = (bit_length(number) - 1) & ~std::size_t(1); ; position -= 2) {
+                // candidate = root + 4^(position/2)
+                std::fill(power.begin(), power.end(), 0);
+                power[position / 64] = uint64_t(1) << (position % 64);
+                candidate = root;
+                add_in_place(candidate, power);
+
+                const auto take = !less(rest, candidate);
+                if (take) {
+                    subtract_in_place(rest, candidate);
+                }
+
+                // root = root / 2 (+ power)
+                for (auto j = std::size_t(0); j < root.size(); ++j) {
+                    const auto high = j + 1 < root.size()? root[j + 1]: 0;
+                    root[j] = (root[j] >> 1) | (high << 63);
+                }
+
+                if (take) {
+                    add_in_place(root, power);
+                }
+
+                if (position == 0) {
+                    break;
+                }
+            }
+
+            return std::all_of(rest.begin(), rest.end(), [](const uint64_t limb) { return limb == 0; });
+        }
+
+        /// @param a any value
+        /// @param n odd number
+        /// @return Jacobi symbol (a/n)
+        static int jacobi_symbol(uint64_t a, uint64_t n) noexcept {
+            auto result = 1;
+            a %= n;
+            while (a != 0) {
+                while (a % 2 == 0) {
+                    a /= 2;
+                    if (n % 8 == 3 || n % 8 == 5) {
+                        result = -result;
+                    }
+                }
+
+                std::swap(a, n);
+                if (a % 4 == 3 && n % 4 == 3) {
+                    result = -result;
+                }
+                a %= n;
+            }
+            return n == 1? result: 0;
+        }
+
+        /// @param d small odd value
+        /// @param n odd number
+        /// @return Jacobi symbol (d/n) using the reciprocity law
+        static int jacobi_symbol(const int64_t d, const limbs_type& n) noexcept {
+            const auto a = static_cast<uint64_t>(d < 0? -d: d);
+            auto result = 1;
+            // (-1/n)
+            if (d < 0 && n[0] % 4 == 3) {
+                result = -result;
+            }
+            // (a/n) = (n/a) for a or n being 1 mod 4, otherwise -(n/a)
+            if (a % 4 == 3 && n[0] % 4 == 3) {
+                result = -result;
+            }
+            return result * jacobi_symbol(remainder(n, a), a);
+        }
+
+        /// @return true when the number is a strong probable prime to base 2
+        static bool is_strong_probable_prime(const montgomery& arithmetic) noexcept {
+            const auto& number = arithmetic.modulus();
+            // number - 1 = odd * 2^shift; bits of number - 1 from bit 1 on are the same as for number
+            const auto shift = lowest_bit_above_zero(number);
+
+            limbs_type minus_one(arithmetic.size(), 0);
+            arithmetic.subtract(arithmetic.zero(), arithmetic.one(), minus_one);
+
+            // value = 2^odd (doubling is an addition)
+            auto value = arithmetic.one();
+            for (auto position = bit_length(number); position-- > shift; ) {
+                arithmetic.multiply(value, value, value);
+                if (bit(number, position)) {
+                    arithmetic.add(value, value, value);
+                }
+            }
+
+            if (value == arithmetic.one() || value == minus_one) {
+                return true;
+            }
+
+            for (auto step = std::size_t(1); step < shift; ++step) {
+                arithmetic.multiply(value, value, value);
+                if (value == minus_one) {
+                    return true;
+                }
+                if (value == arithmetic.one()) {
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        /// @param arithmetic arithmetic modulo the number (no square)
+        /// @return true when the number is a strong Lucas probable prime (Selfridge parameters)
+        static bool is_strong_lucas_probable_prime(const montgomery& arithmetic) noexcept {
+            const auto& number = arithmetic.modulus();
+
+            // first D of 5, -7, 9, -11, ... with (D/n) = -1
+            auto d = int64_t(5);
+            for (auto symbol = jacobi_symbol(d, number); symbol != -1; symbol = jacobi_symbol(d, number)) {
+                if (symbol == 0) {
+                    return false;
+                }
+                d = d > 0? -(d + 2): -(d - 2);
+            }
+
+            // P = 1, Q = (1 - D) / 4
+            const auto big_d = arithmetic.to_montgomery(d);
+            const auto q = arithmetic.to_montgomery((1 - d) / 4);
+
+            // number + 1 = odd * 2^shift
+            limbs_type successor = number;
+            limbs_type one(number.size(), 0);
+            one[0] = 1;
+            if (add_in_place(successor, one) != 0) {
+                successor.push_back(1);
+            }
+            const auto shift = lowest_bit(successor);
+
+            // U(1) = 1, V(1) = P, Q^1
+            auto u = arithmetic.one();
+            auto v = arithmetic.one();
+            auto q_power = q;
+            limbs_type temporary(arithmetic.size(), 0);
+
+            for (auto position = bit_length(successor) - 1; position-- > shift; ) {
+                // U(2k) = U(k) * V(k), V(2k) = V(k)^2 - 2 * Q^k
+                arithmetic.multiply(u, v, u);
+                arithmetic.multiply(v, v, v);
+                arithmetic.subtract(v, q_power, v);
+                arithmetic.subtract(v, q_power, v);
+                arithmetic.multiply(q_power, q_power, q_power);
+
+                if (bit(successor, position)) {
+                    // U(k+1) = (P * U(k) + V(k)) / 2, V(k+1) = (D * U(k) + P * V(k)) / 2
+                    arithmetic.multiply(big_d, u, temporary);
+                    arithmetic.add(u, v, u);
+                    arithmetic.half(u, u);
+                    arithmetic.add(temporary, v, v);
+                    arithmetic.half(v, v);
+                    arithmetic.multiply(q_power, q, q_power);
+                }
+            }
+
+            if (u == arithmetic.zero() || v == arithmetic.zero()) {
+                return true;
+            }
+
+            for (auto step = std::size_t(1); step < shift; ++step) {
+                // V(2k) = V(k)^2 - 2 * Q^k
+                arithmetic.multiply(v, v, v);
+                arithmetic.subtract(v, q_power, v);
+                arithmetic.subtract(v, q_power, v);
+                if (v == arithmetic.zero()) {
+                    return true;
+                }
+                arithmetic.multiply(q_power, q_power, q_power);
+            }
+            return false;
+        }
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_BAILLIE_PSW_H_
@@ -0,0 +1,299 @@
+///
+/// @author  Thomas Lehmann
+/// @file    bucket_sieve.h
+/// @brief   segmented prime sieve with buckets for the large sieving primes
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_BUCKET_SIEVE_H_
+#define INCLUDE_MATH_PRIME_BUCKET_SIEVE_H_
+
+#include <math/isqrt.h>
+#include <math/prime/sieve_interface.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <math/prime/pre_sieve.h>
+#include <math/prime/prime_iterator.h>
+#include <types/bit_operations.h>
+#include <types/bitset.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class bucket_sieve
+/// @brief segmented prime sieve for the window [min_n, max_n] filing the
+///        large sieving primes into buckets (Oliveira e Silva).
+///
+/// The odd numbers of the window are sieved in segments of SEGMENT_BITS
+/// numbers (fitting into the cache) initialized by @ref pre_sieve. A base prime smaller than a segment
+/// (small prime) strikes out its multiples in each segment as usual.
+/// A base prime at least as big as a segment (large prime) hits a segment
+/// at most once: it is filed into the bucket of the segment containing its
+/// next multiple and is visited only when that segment is sieved. The
+/// buckets are organized as ring because the next multiple is never more
+/// than max. prime / SEGMENT_BITS + 1 segments ahead.
+///
+/// Counting and enumerating (see @ref count and @ref stream) do not store
+/// the window; calculate() stores it for the @ref sieve_interface.
+///
+/// @code
+/// math::prime::bucket_sieve<types::bitset<uint64_t>> sieve(0, 10000000000000);
+/// std::cout << sieve.count() << std::endl;   // 346065536839
+/// @endcode
+///
+/// @note numbers outside of the window are never a prime.
+/// @note max_n has to be less than the maximum of uint64_t.
+template <typename T>
+class bucket_sieve final : public sieve_interface<T> {
+    public:
+        /// type of container for keeping true false states
+        using container_type = typename sieve_interface<T>::container_type;
+        /// type for the numbers in the calculation
+        using value_type = uint64_t;
+        /// type of iterator over the primes of the sieve (no virtual calls)
+        using iterator = prime_iterator<bucket_sieve>;
+        /// number of odd numbers sieved at once (32 KiB of bits)
+        enum {SEGMENT_BITS = 262144};
+
+        /// init c'tor which defines the window of numbers that can be
+        /// checked to be a prime (or not)
+        /// @param min_n smallest number of the window
+        /// @param max_n biggest number of the window
+        bucket_sieve(const value_type min_n, const value_type max_n)
+            : sieve_interface<T>(), m_min_n(min_n), m_max_n(max_n), m_first(min_n | 1)
+            , m_size((max_n >= (min_n | 1))? (max_n - (min_n | 1)) / 2 + 1: 0)
+            , m_is_prime(1, false) {}
+
+        /// sieving the window storing the states (required for is_prime and next_prime).
+        /// @throw std::bad_alloc when the states of the window cannot be allocated
+        void calculate() override {
+            m_is_prime.resize(m_size + 1, false);
+            sieve_segments([this](const uint64_t* words, const value_type base_index, const value_type bits) {
+                for (auto bit = types::find_next_bit(words, bits, 0); bit < bits;
+                     bit = types::find_next_bit(words, bits, bit + 1)) {
+                    m_is_prime[base_index + bit] = true;
+                }
+            });
+        }
+
+        /// @return number of primes in the window (without storing the window)
+        value_type count() const {
+            auto result = static_cast<value_type>(contains_two());
+            sieve_segments([&result](const uint64_t* words, const value_type, const value_type bits) {
+                for (auto index = static_cast<value_type>(0); index < (bits + 63) / 64; ++index) {
+                    result += types::population_count(words[index]);
+                }
+            });
+            return result;
+        }
+
+        /// Calling given function for each prime of the window in increasing
+        /// order (without storing the window).
+        /// @param function called with each prime found
+        template <typename F>
+        void stream(F function) const {
+            if (contains_two()) {
+                function(static_cast<value_type>(2));
+            }
+
+            const auto first = m_first;
+            sieve_segments([first, &function](const uint64_t* words, const value_type base_index,
+                                              const value_type bits) {
+                for (auto bit = types::find_next_bit(words, bits, 0); bit < bits;
+                     bit = types::find_next_bit(words, bits, bit + 1)) {
+                    function(first + 2 * (base_index + bit));
+                }
+            });
+        }
+
+        /// @return true when given number is a prime (false when outside of the window)
+        /// @note requires calculate()
+        bool is_prime(const typename container_type::size_type number) const noexcept override {
+            if (number < m_min_n || number > m_max_n) {
+                return false;
+            }
+            if (number % 2 == 0) {
+                return number == 2;
+            }
+            return m_is_prime[(number - m_first) / 2];
+        }
+
+        /// @return the smallest number that can be checked to be a prime
+        value_type min_number() const noexcept {
+            return m_min_n;
+        }
+
+        /// @return the biggest number that can be checked to be a prime
+        value_type max_number() const noexcept override {
+            return m_max_n;
+        }
+
+        /// @return smallest prime >= given number (and inside the window) or max_number() + 1 when there is none
+        /// @note requires calculate()
+        value_type next_prime(const value_type number) const noexcept override {
+            const auto start = std::max(number, m_min_n);
+            if (start <= 2 && m_max_n >= 2) {
+                return 2;
+            }
+
+            const auto index = types::find_next(m_is_prime, (std::max(start, m_first) - m_first + 1) / 2);
+            return (index < m_size)? m_first + 2 * static_cast<value_type>(index): m_max_n + 1;
+        }
+
+        /// @return iterator for the first prime
+        iterator begin() const noexcept {
+            return iterator(this, next_prime(m_min_n));
+        }
+
+        /// @return iterator behind the last prime
+        iterator end() const noexcept {
+            return iterator(this, max_number() + 1);
+        }
+
+        /// Calling given function for each prime in [from, to] (limited to the window).
+        /// @note requires calculate()
+        template <typename F>
+        void for_each_prime(const value_type from, const value_type to, F function) const {
+            prime::for_each_prime(*this, from, to, function);
+        }
+
+    private:
+        /// large prime waiting in a bucket: the prime and the index of its next
+        /// odd multiple inside the segment of the bucket
+        using bucket_entry = std::pair<uint32_t, uint32_t>;
+
+        /// @return true when 2 is inside the window
+        bool contains_two() const noexcept {
+            return m_min_n <= 2 && m_max_n >= 2;
+        }
+
+        /// Sieving the odd numbers of the window segment by segment.
+        /// @param function called for each segment with the words (a set bit
+        ///        is a prime), the index of the first bit in the window and
+        ///        the number of valid bits.
+        template <typename F>
+        void sieve_segments(F function) const {
+            if (m_size == 0) {
+                return;
+            }
+
+            const auto segments = (m_size + SEGMENT_BITS - 1) / SEGMENT_BITS;
+            const auto limit = isqrt(m_max_n);
+
+            // small primes with index of next odd multiple in the window,
+            // large primes (sorted) with index of first odd multiple in the window
+            std::vector<std::pair<value_type, value_type>> small_sieving_primes;
+            std::vector<std::pair<value_type, value_type>> large_primes;
+            if (limit >= pre_sieve::NEXT_PRIME) {
+                sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> base_sieve(limit);
+                base_sieve.calculate();
+                base_sieve.for_each_prime(pre_sieve::NEXT_PRIME, limit,
+                                          [this, &small_sieving_primes, &large_primes](const value_type prime) {
+                    auto multiple = std::max(prime * prime, m_first + (prime - m_first % prime) % prime);
+                    if (multiple % 2 == 0) {
+                        multiple += prime;
+                    }
+                    if (multiple > m_max_n) {
+                        return;
+                    }
+
+                    const auto index = (multiple - m_first) / 2;
+                    if (prime < SEGMENT_BITS) {
+                        small_sieving_primes.push_back(std::make_pair(prime, index));
+                    } else {
+                        large_primes.push_back(std::make_pair(prime, index));
+                    }
+                });
+                // large primes starting at p*p are sorted by p already, the others start in the first segments
+                std::stable_sort(large_primes.begin(), large_primes.end(),
+                    [](const std::pair<value_type, value_type>& lhs, const std::pair<value_type, value_type>& rhs) {
+                        return lhs.second < rhs.second;
+                    });
+            }
+
+            const auto ring_size = static_cast<value_type>(limit / SEGMENT_BITS + 2);
+            std::vector<std::vector<bucket_entry>> buckets(ring_size);
+            std::vector<bucket_entry> current;
+            auto next_large_prime = large_primes.cbegin();
+
+            std::vector<uint64_t> words(SEGMENT_BITS / 64);
+            for (auto segment = static_cast<value_type>(0); segment < segments; ++segment) {
+                const auto base_index = segment * SEGMENT_BITS;
+                const auto bits = std::min(static_cast<value_type>(SEGMENT_BITS), m_size - base_index);
+                // multiples of 3 up to 19 are striked out by tiling a pattern
+                pre_sieve::apply(words.data(), bits, m_first + 2 * base_index, 2);
+
+                // filing large primes when their first multiple is near enough
+                for (; next_large_prime != large_primes.cend()
+                       && next_large_prime->second / SEGMENT_BITS < segment + ring_size - 1; ++next_large_prime) {
+                    const auto target = next_large_prime->second / SEGMENT_BITS;
+                    buckets[target % ring_size].push_back(bucket_entry(
+                        static_cast<uint32_t>(next_large_prime->first),
+                        static_cast<uint32_t>(next_large_prime->second % SEGMENT_BITS)));
+                }
+
+                for (auto& small_prime: small_sieving_primes) {
+                    auto index = small_prime.second - base_index;
+                    for (; index < bits; index += small_prime.first) {
+                        words[index / 64] &= ~(static_cast<uint64_t>(1) << (index % 64));
+                    }
+                    small_prime.second = base_index + index;
+                }
+
+                // each large prime hits the segment once and moves to the bucket of its next multiple
+                std::swap(current, buckets[segment % ring_size]);
+                for (const auto& entry: current) {
+                    words[entry.second / 64] &= ~(static_cast<uint64_t>(1) << (entry.second % 64));
+                    const auto next = static_cast<value_type>(entry.second) + entry.first;
+                    const auto target = segment + next / SEGMENT_BITS;
+                    if (target < segments) {
+                        buckets[target % ring_size].push_back(bucket_entry(
+                            entry.first, static_cast<uint32_t>(next % SEGMENT_BITS)));
+                    }
+                }
+                current.clear();
+
+                if (segment == 0 && m_first == 1) {
+                    words[0] &= ~static_cast<uint64_t>(1);
+                }
+
+                function(words.data(), base_index, bits);
+            }
+        }
+
+        /// the smallest number that can be checked to be a prime
+        const value_type m_min_n;
+        /// the biggest number that can be checked to be a prime
+        const value_type m_max_n;
+        /// the smallest odd number >= m_min_n (represented by index 0)
+        const value_type m_first;
+        /// number of odd numbers in the window
+        const value_type m_size;
+        /// container for keeping true/false states of the odd numbers in the window
+        /// (plus one false state: a container cannot be empty)
+        container_type m_is_prime;
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_BUCKET_SIEVE_H_
@@ -0,0 +1,94 @@
+///
+/// @author  Thomas Lehmann
+/// @file    count_primes.h
+/// @brief   prime counting function without a full sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_COUNT_PRIMES_H_
+#define INCLUDE_MATH_PRIME_COUNT_PRIMES_H_
+
+#include <math/isqrt.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <types/bitset.h>
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// Counting the primes <= x (the prime counting function \f$\pi(x)\f$) using
+/// the algorithm of Lucy_Hedgehog with \f$O(x^{3/4})\f$ operations and
+/// \f$O(\sqrt{x})\f$ memory. The only sieve required is the one up to \f$\sqrt{x}\f$.
+///
+/// Idea: S(v) is the number of values in [2, v] surviving the sieve with all primes < p.
+/// Initially S(v) = v - 1. Sieving with prime p does remove the multiples of p having
+/// no smaller prime factor: \f$S(v) = S(v) - (S(v/p) - S(p-1))\f$ for all \f$v \ge p^2\f$.
+/// Only the values \f$v = \lfloor x/i \rfloor\f$ are required which are at most
+/// \f$2\sqrt{x}\f$ different values.
+///
+/// @code
+/// assert_that(uint64_t(168), is_equal(math::prime::count_primes(1000)));
+/// @endcode
+///
+/// @param x limit for counting primes (inclusive)
+/// @return number of primes <= x
+/// @see https://projecteuler.net/thread=10;page=5#111677
+inline uint64_t count_primes(const uint64_t x) {
+    if (x < 2) {
+        return 0;
+    }
+
+    const auto root = isqrt(x);
+
+    // small[v] = S(v) for v <= root, large[i] = S(x/i) for i <= root
+    std::vector<uint32_t> small(root + 1);
+    std::vector<uint64_t> large(root + 1);
+    for (uint64_t value = 1; value <= root; ++value) {
+        small[value] = static_cast<uint32_t>(value - 1);
+        large[value] = x / value - 1;
+    }
+
+    sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(root);
+    sieve.calculate();
+
+    sieve.for_each_prime(2, root, [x, root, &small, &large](const uint64_t prime) {
+        const auto count_before = static_cast<uint64_t>(small[prime - 1]);
+        const auto square = prime * prime;
+
+        const auto limit_large = std::min(root, x / square);
+        for (uint64_t index = 1; index <= limit_large; ++index) {
+            const auto divisor = index * prime;
+            const auto surviving = (divisor <= root)? large[divisor]: small[x / divisor];
+            large[index] -= surviving - count_before;
+        }
+
+        for (auto value = root; value >= square; --value) {
+            small[value] -= static_cast<uint32_t>(small[value / prime] - count_before);
+        }
+    });
+
+    return large[1];
+}
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_COUNT_PRIMES_H_
@@ -0,0 +1,196 @@
+///
+/// @author  Thomas Lehmann
+/// @file    extendable_sieve.h
+/// @brief   prime sieve which can be extended without recalculation
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_EXTENDABLE_SIEVE_H_
+#define INCLUDE_MATH_PRIME_EXTENDABLE_SIEVE_H_
+
+#include <math/isqrt.h>
+#include <math/prime/sieve_interface.h>
+#include <math/prime/sieve_facade.h>
+#include <math/prime/prime_iterator.h>
+#include <types/bitset.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class extendable_sieve
+/// @brief prime sieve which can grow to a higher limit sieving the new range only.
+///
+/// For each base prime p (\f$p^2 \le\f$ current limit) the next odd multiple
+/// which has not been striked out yet is stored. Extending the sieve does
+/// continue striking out at these offsets; new base primes start at \f$p^2\f$
+/// (which is behind the previous limit). When the square root of the new
+/// limit is behind the current limit the sieve is extended in steps.
+///
+/// @code
+/// math::prime::extendable_sieve<types::bitset<uint64_t>> sieve(1000);
+/// sieve.calculate();
+/// sieve.extend_to(1000000);   // sieving (1000, 1000000] only
+/// @endcode
+///
+/// @note does NOT store even values (less memory consumption)
+/// @note the container has to provide resize(size, flag) like std::vector<bool>
+///       and @ref types::bitset do.
+/// @note is_prime is a pure query (false behind the limit); growing on
+///       demand is the explicit non const call @ref extending_is_prime.
+template <typename T>
+class extendable_sieve final : public sieve_interface<T>, public sieve_facade<extendable_sieve<T>> {
+    public:
+        /// type of container for keeping true false states
+        using container_type = typename sieve_interface<T>::container_type;
+        /// type for the numbers in the calculation
+        using value_type = uint64_t;
+        /// type of iterator over the primes of the sieve (no virtual calls)
+        using iterator = prime_iterator<extendable_sieve>;
+        /// layout of the states (see @ref sieve_facade)
+        enum {ODD_NUMBERS_ONLY = true};
+
+        /// init c'tor which defines the maximum number for the first calculation
+        /// @param max_n maximum number that can be checked after calculation
+        explicit extendable_sieve(const value_type max_n)
+            : sieve_interface<T>(), m_requested_max_n(max_n)
+            , m_max_n(1), m_is_prime(1, false), m_base_primes() {}
+
+        /// calculating the prime states up to the maximum number given in the c'tor.
+        /// @throw std::bad_alloc when the states cannot be allocated
+        void calculate() override {
+            grow(m_requested_max_n);
+        }
+
+        /// Sieving the range behind current limit up to the new limit.
+        /// @param new_max_n new maximum number (nothing is done when not bigger than current one)
+        /// @throw std::bad_alloc when the states cannot be allocated
+        void extend_to(const value_type new_max_n) {
+            grow(new_max_n);
+        }
+
+        /// @return true when given number is a prime
+        /// @note a number behind the limit is never a prime (see @ref extending_is_prime)
+        bool is_prime(const typename container_type::size_type number) const noexcept override {
+            return number <= m_max_n && this->lookup(number);
+        }
+
+        /// Checking a number extending the sieve first when the number is behind
+        /// the limit (at least doubling the limit).
+        /// @return true when given number is a prime
+        /// @throw std::bad_alloc when the states cannot be allocated
+        bool extending_is_prime(const value_type number) {
+            if (number > m_max_n) {
+                grow(std::max(number, 2 * m_max_n));
+            }
+
+            return this->lookup(number);
+        }
+
+        /// @return state for given index (no range check; see @ref sieve_facade)
+        inline bool state(const value_type index) const noexcept {
+            return m_is_prime[index];
+        }
+
+        /// reading states for given indices (no range check; see @ref sieve_facade)
+        inline void gather(const uint64_t* indices, const std::size_t count, uint8_t* results) const noexcept {
+            types::gather(m_is_prime, indices, count, results);
+        }
+
+        /// @return the biggest number that can be checked to be a prime
+        value_type max_number() const noexcept override {
+            return m_max_n;
+        }
+
+        /// @return smallest prime >= given number or max_number() + 1 when there is none
+        value_type next_prime(const value_type number) const noexcept override {
+            if (number <= 2) {
+                return (m_max_n >= 2)? 2: m_max_n + 1;
+            }
+
+            const auto index = types::find_next(m_is_prime, number / 2);
+            const auto prime = 2 * static_cast<value_type>(index) + 1;
+            return (prime <= m_max_n)? prime: m_max_n + 1;
+        }
+
+        /// @return iterator for the first prime
+        iterator begin() const noexcept {
+            return iterator(this, next_prime(0));
+        }
+
+        /// @return iterator behind the last prime
+        iterator end() const noexcept {
+            return iterator(this, max_number() + 1);
+        }
+
+        /// Calling given function for each prime in [from, to].
+        template <typename F>
+        void for_each_prime(const value_type from, const value_type to, F function) const {
+            prime::for_each_prime(*this, from, to, function);
+        }
+
+    private:
+        /// sieving (m_max_n, new_max_n]
+        void grow(const value_type new_max_n) {
+            if (new_max_n <= m_max_n) {
+                return;
+            }
+
+            // all base primes have to be known before
+            const auto limit = isqrt(new_max_n);
+            if (limit > m_max_n) {
+                grow(limit);
+            }
+
+            const auto first_new_base_prime = m_base_primes.empty()? 3: m_base_primes.back().first + 2;
+            for (auto prime = next_prime(first_new_base_prime); prime <= limit; prime = next_prime(prime + 1)) {
+                m_base_primes.push_back(std::make_pair(prime, prime * prime));
+            }
+
+            m_is_prime.resize(new_max_n / 2 + 1, true);
+
+            for (auto& base_prime: m_base_primes) {
+                const auto offset = 2 * base_prime.first;
+                auto multiple = base_prime.second;
+                for (; multiple <= new_max_n; multiple += offset) {
+                    m_is_prime[multiple / 2] = false;
+                }
+                base_prime.second = multiple;
+            }
+
+            m_max_n = new_max_n;
+        }
+
+        /// the maximum number for the first calculation
+        const value_type m_requested_max_n;
+        /// the biggest number that can be checked to be a prime
+        value_type m_max_n;
+        /// container for keeping true/false states of odd numbers
+        container_type m_is_prime;
+        /// odd base primes with next odd multiple to strike out
+        std::vector<std::pair<value_type, value_type>> m_base_primes;
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_EXTENDABLE_SIEVE_H_
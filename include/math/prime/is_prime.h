@@ -23,28 +23,43 @@
 #ifndef INCLUDE_MATH_PRIME_IS_PRIME_H_
 #define INCLUDE_MATH_PRIME_IS_PRIME_H_
 
+#include <math/prime/small_primes.h>
 #include <cmath>
+#include <cstdint>
 
 namespace math {
 namespace prime {
 
 /// @param value value to be checked
 /// @return true when given value is a prime
+/// @note values below 65536 are one lookup in @ref small_primes_table, bigger
+///       ones are divided by the primes of that table first.
 /// @note for really big numbers or for creating a list of primes
 ///       consider to use a sieve algorithms. This algorithm is
 ///       rather slow.
 template <typename T>
 inline bool is_prime(const T& value) noexcept {
+    using table = small_primes_table<void>;
+
     if (value < 2) {
         return false;
     }
 
-    if (value % 2 == 0) {
-        return value == 2;
+    if (value < table::LIMIT) {
+        return table::is_prime(static_cast<uint32_t>(value));
     }
 
     const auto limit = static_cast<T>(sqrt(value));
-    for (T divisor = 3; divisor <= limit; divisor += 2) {
+    for (const auto prime: table::primes) {
+        if (prime > limit) {
+            return true;
+        }
+        if (value % prime == 0) {
+            return false;
+        }
+    }
+
+    for (T divisor = table::LIMIT + 1; divisor <= limit; divisor += 2) {
         if (value % divisor == 0) {
             return false;
         }
@@ -0,0 +1,331 @@
+///
+/// @author  Thomas Lehmann
+/// @file    mapped_sieve.h
+/// @brief   prime sieve read from a memory mapped file
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_MAPPED_SIEVE_H_
+#define INCLUDE_MATH_PRIME_MAPPED_SIEVE_H_
+
+#include <math/prime/sieve_interface.h>
+#include <math/prime/sieve_facade.h>
+#include <math/prime/prime_iterator.h>
+#include <types/bit_operations.h>
+
+#include <stdexcept>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace math {
+namespace prime {
+
+/// @struct mapped_sieve_header
+/// @brief header of a sieve file followed by the packed bitmap.
+///
+/// The bitmap consists of 64 bit words (native byte order) where bit n
+/// (bit n%64 of word n/64) represents the odd number 2n+1.
+struct mapped_sieve_header final {
+    /// @return magic text at the beginning of each sieve file
+    static const char* magic_text() noexcept {
+        return "PRIMSIEV";
+    }
+
+    /// current version of the file format
+    enum {FORMAT_VERSION = 1};
+    /// layout of the bitmap: odd numbers only
+    enum {LAYOUT_ODD = 1};
+
+    char magic[8];       ///! always "PRIMSIEV" (without terminating zero)
+    uint32_t version;    ///! version of file format
+    uint32_t layout;     ///! layout of bitmap
+    uint64_t max_number; ///! biggest number that can be checked to be a prime
+    uint64_t words;      ///! number of 64 bit words in the bitmap
+};
+
+static_assert(sizeof(mapped_sieve_header) == 32, "sieve file header is expected to have 32 bytes");
+
+/// @class mapped_sieve
+/// @brief sieve using a calculated bitmap from a memory mapped file.
+///
+/// A sieve has to be calculated once only and can be written to a file which is then
+/// mapped read only into memory: a start is a page-in rather than a recompute and all
+/// processes using the same file share the same physical pages.
+///
+/// @code
+/// math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(1000000);
+/// sieve.calculate();
+/// math::prime::mapped_sieve<types::bitset<uint64_t>>::write("primes.sieve", sieve);
+///
+/// const math::prime::mapped_sieve<types::bitset<uint64_t>> mapped("primes.sieve");
+/// assert_that(true, is_equal(mapped.is_prime(999983)));
+/// @endcode
+///
+/// @note the template parameter is for the @ref sieve_interface only;
+///       the bitmap is always stored as 64 bit words.
+template <typename T>
+class mapped_sieve final : public sieve_interface<T>, public sieve_facade<mapped_sieve<T>> {
+    public:
+        /// type of container for keeping true false states
+        using container_type = typename sieve_interface<T>::container_type;
+        /// type for the numbers in the calculation
+        using value_type = uint64_t;
+        /// type of iterator over the primes of the sieve (no virtual calls)
+        using iterator = prime_iterator<mapped_sieve>;
+        /// layout of the states (see @ref sieve_facade)
+        enum {ODD_NUMBERS_ONLY = true};
+
+        /// mapping given sieve file into memory
+        /// @param filename path and name of sieve file
+        /// @throw std::runtime_error when file cannot be mapped or has wrong format
+        explicit mapped_sieve(const std::string& filename)
+            : sieve_interface<T>(), m_data(nullptr), m_size(0), m_max_n(0), m_bits(0), m_words(nullptr) {
+            map(filename);
+
+            mapped_sieve_header header;
+            if (m_size < sizeof(header)) {
+                unmap();
+                throw std::runtime_error("Sieve file is too small: " + filename);
+            }
+
+            std::memcpy(&header, m_data, sizeof(header));
+            if (std::memcmp(header.magic, mapped_sieve_header::magic_text(), sizeof(header.magic)) != 0
+                || header.version != mapped_sieve_header::FORMAT_VERSION
+                || header.layout != mapped_sieve_header::LAYOUT_ODD
+                || header.words != (header.max_number / 2) / 64 + 1
+                || m_size < sizeof(header) + header.words * sizeof(uint64_t)) {
+                unmap();
+                throw std::runtime_error("Wrong format or version of sieve file: " + filename);
+            }
+
+            m_max_n = header.max_number;
+            m_bits = m_max_n / 2 + 1;
+            m_words = reinterpret_cast<const uint64_t*>(m_data + sizeof(header));
+        }
+
+        /// unmapping the file
+        ~mapped_sieve() {
+            unmap();
+        }
+
+        /// Writing the primes of given (calculated) sieve to a file in the format
+        /// expected by this class. The file is written under a temporary name first
+        /// and then renamed for not disturbing processes reading a previous version
+        /// (the temporary file is removed again when writing or renaming fails).
+        ///
+        /// @param filename path and name of sieve file
+        /// @param sieve any calculated sieve providing for_each_prime and max_number
+        /// @throw std::runtime_error when file cannot be written
+        template <typename S>
+        static void write(const std::string& filename, const S& sieve) {
+            mapped_sieve_header header;
+            std::memcpy(header.magic, mapped_sieve_header::magic_text(), sizeof(header.magic));
+            header.version = mapped_sieve_header::FORMAT_VERSION;
+            header.layout = mapped_sieve_header::LAYOUT_ODD;
+            header.max_number = sieve.max_number();
+            header.words = (header.max_number / 2) / 64 + 1;
+
+            std::vector<uint64_t> words(header.words, 0);
+            sieve.for_each_prime(3, header.max_number, [&words](const uint64_t prime) {
+                words[prime / 128] |= static_cast<uint64_t>(1) << ((prime / 2) % 64);
+            });
+
+            const auto temporary_filename = filename + ".tmp";
+            auto written = false;
+            {
+                std::ofstream stream(temporary_filename, std::ios::binary | std::ios::trunc);
+                stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                stream.write(reinterpret_cast<const char*>(words.data()), words.size() * sizeof(uint64_t));
+                stream.close();
+                written = !stream.fail();
+            }
+
+            if (!written) {
+                std::remove(temporary_filename.c_str());
+                throw std::runtime_error("Cannot write sieve file: " + temporary_filename);
+            }
+
+            // replacing an existing file in one step (readers keep the previous version)
+#if defined(_WIN32)
+            const auto renamed = MoveFileExA(temporary_filename.c_str(), filename.c_str(),
+                                             MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+            const auto renamed = std::rename(temporary_filename.c_str(), filename.c_str()) == 0;
+#endif
+            if (!renamed) {
+                std::remove(temporary_filename.c_str());
+                throw std::runtime_error("Cannot rename sieve file to: " + filename);
+            }
+        }
+
+        /// nothing to calculate: the file contains the result
+        void calculate() noexcept override {}
+
+        /// @return true when given number is a prime (false when behind max. number)
+        bool is_prime(const typename container_type::size_type number) const noexcept override {
+            return this->lookup(number);
+        }
+
+        /// @return state for given index (no range check; see @ref sieve_facade)
+        inline bool state(const value_type index) const noexcept {
+            return (m_words[index / 64] >> (index % 64)) & 1;
+        }
+
+        /// reading states for given indices (no range check; see @ref sieve_facade)
+        inline void gather(const uint64_t* indices, const std::size_t count, uint8_t* results) const noexcept {
+            types::gather_bits(m_words, indices, count, results);
+        }
+
+        /// @return the biggest number that can be checked to be a prime
+        value_type max_number() const noexcept override {
+            return m_max_n;
+        }
+
+        /// @return smallest prime >= given number or max_number() + 1 when there is none
+        value_type next_prime(const value_type number) const noexcept override {
+            if (number <= 2) {
+                return (m_max_n >= 2)? 2: m_max_n + 1;
+            }
+
+            const auto prime = 2 * types::find_next_bit(m_words, m_bits, number / 2) + 1;
+            return (prime <= m_max_n)? prime: m_max_n + 1;
+        }
+
+        /// @return iterator for the first prime
+        iterator begin() const noexcept {
+            return iterator(this, next_prime(0));
+        }
+
+        /// @return iterator behind the last prime
+        iterator end() const noexcept {
+            return iterator(this, max_number() + 1);
+        }
+
+        /// Calling given function for each prime in [from, to].
+        template <typename F>
+        void for_each_prime(const value_type from, const value_type to, F function) const {
+            prime::for_each_prime(*this, from, to, function);
+        }
+
+    private:
+        /// disable copy c'tor
+        mapped_sieve(const mapped_sieve&) = delete;
+        /// disable assignment
+        mapped_sieve& operator = (const mapped_sieve&) = delete;
+
+#if defined(_WIN32)
+        /// mapping whole file read only into memory
+        void map(const std::string& filename) {
+            const auto file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error("Cannot open sieve file: " + filename);
+            }
+
+            LARGE_INTEGER size;
+            const auto mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0
+                ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr): nullptr;
+            CloseHandle(file);
+            if (mapping == nullptr) {
+                throw std::runtime_error("Cannot map sieve file: " + filename);
+            }
+
+            m_data = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mapping);
+            if (m_data == nullptr) {
+                throw std::runtime_error("Cannot map sieve file: " + filename);
+            }
+            m_size = static_cast<std::size_t>(size.QuadPart);
+        }
+
+        /// releasing the mapped memory
+        void unmap() noexcept {
+            if (m_data != nullptr) {
+                UnmapViewOfFile(m_data);
+                m_data = nullptr;
+            }
+        }
+#else
+        /// mapping whole file read only (and shared) into memory
+        void map(const std::string& filename) {
+            const auto file = open(filename.c_str(), O_RDONLY);
+            if (file < 0) {
+                throw std::runtime_error("Cannot open sieve file: " + filename);
+            }
+
+            struct stat status;
+            if (fstat(file, &status) != 0 || status.st_size == 0) {
+                close(file);
+                throw std::runtime_error("Cannot map sieve file: " + filename);
+            }
+
+            const auto size = static_cast<std::size_t>(status.st_size);
+            const auto data = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+            close(file);
+            if (data == MAP_FAILED) {
+                throw std::runtime_error("Cannot map sieve file: " + filename);
+            }
+
+            m_data = static_cast<const unsigned char*>(data);
+            m_size = size;
+        }
+
+        /// releasing the mapped memory
+        void unmap() noexcept {
+            if (m_data != nullptr) {
+                munmap(const_cast<unsigned char*>(m_data), m_size);
+                m_data = nullptr;
+            }
+        }
+#endif
+
+        /// mapped file content
+        const unsigned char* m_data;
+        /// size of mapped file in bytes
+        std::size_t m_size;
+        /// the biggest number that can be checked to be a prime
+        value_type m_max_n;
+        /// number of bits in the bitmap
+        value_type m_bits;
+        /// the bitmap behind the header
+        const uint64_t* m_words;
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_MAPPED_SIEVE_H_
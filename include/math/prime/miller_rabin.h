@@ -0,0 +1,200 @@
+///
+/// @author  Thomas Lehmann
+/// @file    miller_rabin.h
+/// @brief   deterministic Miller-Rabin prime test for 64 bit numbers
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_MILLER_RABIN_H_
+#define INCLUDE_MATH_PRIME_MILLER_RABIN_H_
+
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class montgomery_u64
+/// @brief multiplication modulo an odd 64 bit number without division (values in Montgomery form a * 2^64 mod n).
+class montgomery_u64 final {
+    public:
+        /// @param modulus odd number > 1
+        explicit montgomery_u64(const uint64_t modulus) noexcept
+            : m_modulus(modulus), m_inverse(inverse(modulus))
+            , m_one((0 - modulus) % modulus)
+            , m_square(static_cast<uint64_t>(static_cast<wide_type>(m_one) * m_one % modulus)) {
+        }
+
+        /// @return the modulus
+        uint64_t modulus() const noexcept {
+            return m_modulus;
+        }
+
+        /// @return 1 in Montgomery form
+        uint64_t one() const noexcept {
+            return m_one;
+        }
+
+        /// @return given value in Montgomery form
+        uint64_t to_montgomery(const uint64_t value) const noexcept {
+            return multiply(value % m_modulus, m_square);
+        }
+
+        /// @return given value in Montgomery form as normal value
+        uint64_t from_montgomery(const uint64_t value) const noexcept {
+            return reduce(value);
+        }
+
+        /// @return lhs * rhs (both in Montgomery form)
+        uint64_t multiply(const uint64_t lhs, const uint64_t rhs) const noexcept {
+            return reduce(static_cast<wide_type>(lhs) * rhs);
+        }
+
+        /// @return lhs + rhs (both in Montgomery form)
+        uint64_t add(const uint64_t lhs, const uint64_t rhs) const noexcept {
+            const auto sum = lhs + rhs;
+            return (sum < lhs || sum >= m_modulus)? sum - m_modulus: sum;
+        }
+
+        /// @return lhs - rhs (both in Montgomery form)
+        uint64_t subtract(const uint64_t lhs, const uint64_t rhs) const noexcept {
+            return lhs >= rhs? lhs - rhs: lhs - rhs + m_modulus;
+        }
+
+        /// @return base^exponent (base in Montgomery form)
+        uint64_t power(uint64_t base, uint64_t exponent) const noexcept {
+            auto result = m_one;
+            for (; exponent > 0; exponent >>= 1) {
+                if (exponent & 1) {
+                    result = multiply(result, base);
+                }
+                base = multiply(base, base);
+            }
+            return result;
+        }
+
+    private:
+        /// type for the product of two values
+        __extension__ typedef unsigned __int128 wide_type;
+
+        /// @return 1 / value mod 2^64 (value has to be odd)
+        static uint64_t inverse(const uint64_t value) noexcept {
+            // each Newton step doubles the number of correct bits (3 at the start)
+            auto result = value;
+            for (auto step = 0; step < 5; ++step) {
+                result *= 2 - value * result;
+            }
+            return result;
+        }
+
+        /// @return value / 2^64 mod n; the low words of value and m * n are equal so no overflow can happen
+        uint64_t reduce(const wide_type value) const noexcept {
+            const auto m = static_cast<uint64_t>(value) * m_inverse;
+            const auto high = static_cast<uint64_t>(value >> 64);
+            const auto correction = static_cast<uint64_t>((static_cast<wide_type>(m) * m_modulus) >> 64);
+            return high >= correction? high - correction: high - correction + m_modulus;
+        }
+
+        /// the odd modulus n
+        uint64_t m_modulus;
+        /// 1 / n mod 2^64
+        uint64_t m_inverse;
+        /// 2^64 mod n
+        uint64_t m_one;
+        /// 2^128 mod n
+        uint64_t m_square;
+};
+
+/// @class miller_rabin
+/// @brief deterministic Miller-Rabin prime test for all 64 bit numbers.
+///
+/// The seven bases of Jim Sinclair are enough to be sure for all numbers
+/// below 2^64; no composite number is a strong probable prime to all of them.
+///
+/// @code
+/// math::prime::miller_rabin::is_prime(18446744073709551557ULL);  // true (biggest 64 bit prime)
+/// @endcode
+///
+/// @see http://miller-rabin.appspot.com
+class miller_rabin final {
+    public:
+        /// no instances
+        miller_rabin() = delete;
+
+        /// @param number any number
+        /// @return true when given number is a prime
+        static bool is_prime(const uint64_t number) noexcept {
+            if (number < 2) {
+                return false;
+            }
+
+            for (const auto prime: {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+                if (number % prime == 0) {
+                    return number == static_cast<uint64_t>(prime);
+                }
+            }
+
+            if (number < 41 * 41) {
+                return true;
+            }
+
+            const montgomery_u64 arithmetic(number);
+            for (const auto base: {2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL}) {
+                if (!is_strong_probable_prime(arithmetic, base)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @param arithmetic arithmetic modulo the number to check (odd number)
+        /// @param base base of the test
+        /// @return true when the number is a strong probable prime to given base
+        static bool is_strong_probable_prime(const montgomery_u64& arithmetic, const uint64_t base) noexcept {
+            const auto number = arithmetic.modulus();
+            const auto value = arithmetic.to_montgomery(base);
+            if (value == 0) {
+                return true;
+            }
+
+            // number - 1 = odd * 2^shift
+            auto odd = number - 1;
+            auto shift = 0;
+            for (; odd % 2 == 0; odd /= 2) {
+                ++shift;
+            }
+
+            const auto minus_one = arithmetic.subtract(0, arithmetic.one());
+            auto power = arithmetic.power(value, odd);
+            if (power == arithmetic.one() || power == minus_one) {
+                return true;
+            }
+
+            for (auto step = 1; step < shift; ++step) {
+                power = arithmetic.multiply(power, power);
+                if (power == minus_one) {
+                    return true;
+                }
+            }
+            return false;
+        }
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_MILLER_RABIN_H_
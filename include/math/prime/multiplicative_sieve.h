@@ -0,0 +1,200 @@
+///
+/// @author  Thomas Lehmann
+/// @file    multiplicative_sieve.h
+/// @brief   linear sieve for multiplicative functions (phi, mu, omega)
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_MULTIPLICATIVE_SIEVE_H_
+#define INCLUDE_MATH_PRIME_MULTIPLICATIVE_SIEVE_H_
+
+#include <types/bitset.h>
+
+#include <stdexcept>
+#include <vector>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class multiplicative_sieve
+/// @brief Euler's totient, Moebius function and number of distinct prime factors for all n <= max_n.
+///
+/// One linear sieve pass (O(N)) writes each composite number exactly once as
+/// i * p with p being its smallest prime factor. When p does not divide i the
+/// functions are derived from i and p (phi(i) * (p - 1), -mu(i), omega(i) + 1)
+/// otherwise from i alone (phi(i) * p, 0, omega(i)). Only the selected outputs
+/// are allocated.
+///
+/// @code
+/// using math::prime::multiplicative_sieve;
+/// multiplicative_sieve sieve(1000, multiplicative_sieve::PHI | multiplicative_sieve::MU);
+/// sieve.calculate();
+///
+/// // squarefree numbers (no recomputation inside of the filter)
+/// const auto numbers = generator::select(uint32_t(1), uint32_t(1000), uint32_t(1))
+///     .where([&sieve](const uint32_t number) { return sieve.mu(number) != 0; })
+///     .to_vector();
+/// @endcode
+///
+/// @see https://en.wikipedia.org/wiki/Euler%27s_totient_function
+/// @see https://en.wikipedia.org/wiki/M%C3%B6bius_function
+class multiplicative_sieve final {
+    public:
+        /// type for the numbers
+        using value_type = uint32_t;
+
+        /// outputs of the sieve (can be combined)
+        enum output {
+            /// Euler's totient (number of k <= n being coprime to n)
+            PHI = 1,
+            /// Moebius function (0 when n has a square factor, else (-1)^omega(n))
+            MU = 2,
+            /// number of distinct prime factors
+            OMEGA = 4,
+            /// all of them
+            ALL = PHI | MU | OMEGA
+        };
+
+        /// init c'tor
+        /// @param max_n biggest number for which to calculate the functions
+        /// @param outputs combination of the output flags
+        multiplicative_sieve(const value_type max_n, const unsigned outputs = ALL)
+            : m_max_n(max_n), m_outputs(outputs)
+            , m_phi((outputs & PHI)? max_n + 1: 0, 0)
+            , m_mu((outputs & MU)? max_n + 1: 0, 0)
+            , m_omega((outputs & OMEGA)? max_n + 1: 0, 0) {
+        }
+
+        /// linear sieve filling the selected outputs
+        void calculate() {
+            if (m_max_n >= 1) {
+                set(1, 1, 1, 0);
+            }
+
+            types::bitset<uint64_t> is_composite(static_cast<std::size_t>(m_max_n) + 1);
+            std::vector<value_type> primes;
+
+            for (auto number = uint64_t(2); number <= m_max_n; ++number) {
+                const auto value = static_cast<value_type>(number);
+                if (!is_composite[value]) {
+                    primes.push_back(value);
+                    set(value, value - 1, -1, 1);
+                }
+
+                for (const auto prime: primes) {
+                    const auto multiple = number * prime;
+                    if (multiple > m_max_n) {
+                        break;
+                    }
+
+                    const auto target = static_cast<value_type>(multiple);
+                    is_composite[target] = true;
+                    if (value % prime == 0) {
+                        // prime is the smallest factor of number: one more factor p of the same prime power
+                        set(target, phi_or_zero(value) * prime, 0, omega_or_zero(value));
+                        break;
+                    }
+
+                    set(target, phi_or_zero(value) * (prime - 1), static_cast<int8_t>(-mu_or_zero(value)),
+                        static_cast<uint8_t>(omega_or_zero(value) + 1));
+                }
+            }
+        }
+
+        /// @return biggest number for which the functions are known
+        value_type max_number() const noexcept {
+            return m_max_n;
+        }
+
+        /// @param number number with 1 <= number <= max_number()
+        /// @return Euler's totient of given number
+        /// @throw std::runtime_error when PHI has not been selected
+        value_type phi(const value_type number) const {
+            check(PHI);
+            return m_phi[number];
+        }
+
+        /// @param number number with 1 <= number <= max_number()
+        /// @return Moebius function of given number
+        /// @throw std::runtime_error when MU has not been selected
+        int mu(const value_type number) const {
+            check(MU);
+            return m_mu[number];
+        }
+
+        /// @param number number with 1 <= number <= max_number()
+        /// @return number of distinct prime factors of given number
+        /// @throw std::runtime_error when OMEGA has not been selected
+        value_type omega(const value_type number) const {
+            check(OMEGA);
+            return m_omega[number];
+        }
+
+    private:
+        /// @throw std::runtime_error when given output has not been selected
+        void check(const output wanted) const {
+            if ((m_outputs & wanted) == 0) {
+                throw std::runtime_error("output of multiplicative sieve has not been selected");
+            }
+        }
+
+        /// storing the selected values for given number
+        void set(const value_type number, const value_type phi, const int8_t mu, const uint8_t omega) noexcept {
+            if (m_outputs & PHI) {
+                m_phi[number] = phi;
+            }
+            if (m_outputs & MU) {
+                m_mu[number] = mu;
+            }
+            if (m_outputs & OMEGA) {
+                m_omega[number] = omega;
+            }
+        }
+
+        /// @return phi of given number or 0 when not selected
+        value_type phi_or_zero(const value_type number) const noexcept {
+            return (m_outputs & PHI)? m_phi[number]: 0;
+        }
+
+        /// @return mu of given number or 0 when not selected
+        int8_t mu_or_zero(const value_type number) const noexcept {
+            return (m_outputs & MU)? m_mu[number]: 0;
+        }
+
+        /// @return omega of given number or 0 when not selected
+        uint8_t omega_or_zero(const value_type number) const noexcept {
+            return (m_outputs & OMEGA)? m_omega[number]: 0;
+        }
+
+        /// biggest number for which to calculate the functions
+        value_type m_max_n;
+        /// selected outputs
+        unsigned m_outputs;
+        /// Euler's totient for each number (empty when not selected)
+        std::vector<value_type> m_phi;
+        /// Moebius function for each number (empty when not selected)
+        std::vector<int8_t> m_mu;
+        /// number of distinct prime factors for each number (empty when not selected)
+        std::vector<uint8_t> m_omega;
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_MULTIPLICATIVE_SIEVE_H_
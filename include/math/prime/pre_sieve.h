@@ -0,0 +1,213 @@
+///
+/// @author  Thomas Lehmann
+/// @file    pre_sieve.h
+/// @brief   pre-sieving the smallest primes by tiling periodic bit patterns
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_PRE_SIEVE_H_
+#define INCLUDE_MATH_PRIME_PRE_SIEVE_H_
+
+#include <types/bitset.h>
+
+#include <algorithm>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class pre_sieve
+/// @brief initializes sieve states with the multiples of 3, 5, 7, 11, 13, 17
+///        and 19 already striked out.
+///
+/// The states of the multiples of these primes are periodic: for the
+/// product P of the primes the pattern repeats after P numbers (or after
+/// P odd numbers). Two byte patterns are built once: one for 3 up to 13
+/// (P = 15015) and one for 17 and 19 (P = 323). The first one is copied
+/// (memcpy) into the words of the sieve, the second one is combined with
+/// a bitwise and. Each pattern has a period of P bytes (8P bits are a
+/// multiple of P bits) and the start inside the pattern for any first
+/// number is the byte k with \f$8k \equiv first \pmod P\f$.
+///
+/// A sieve can start striking out with @ref NEXT_PRIME then.
+///
+/// @code
+/// std::vector<uint64_t> words(1024);
+/// // bit j represents the odd number 1 + 2j
+/// math::prime::pre_sieve::apply(words.data(), 65536, 1, 2);
+/// @endcode
+///
+/// @note the byte patterns are used on little endian machines only; otherwise
+///       (and for containers without word access) the primes are striked out.
+class pre_sieve final {
+    public:
+        /// first prime that is not pre-sieved
+        enum {NEXT_PRIME = 23};
+
+        /// Initializing the states of given words: a bit is set when the
+        /// number is not a multiple of 2 (step 1 only), 3, 5, ..., 19
+        /// or when the number is one of these primes.
+        ///
+        /// @param words words of the sieve (bit j is bit j%64 of word j/64)
+        /// @param number_of_bits number of bits to initialize (the other bits of the last word are cleared)
+        /// @param first the number represented by bit 0 (has to be odd for step 2)
+        /// @param step distance of the numbers of two neighbour bits (1 or 2)
+        static void apply(uint64_t* words, const uint64_t number_of_bits, const uint64_t first, const uint64_t step) {
+            if (number_of_bits == 0) {
+                return;
+            }
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            std::fill(words, words + (number_of_bits + 63) / 64, ~static_cast<uint64_t>(0));
+            strike([words](const uint64_t bit) {
+                words[bit / 64] &= ~(static_cast<uint64_t>(1) << (bit % 64));
+            }, number_of_bits, first, step);
+#else
+            const auto bytes = reinterpret_cast<uint8_t*>(words);
+            const auto number_of_bytes = (number_of_bits + 7) / 8;
+            // pattern bit t represents the number t (step 1) or 2t+1 (step 2)
+            const auto offset = (step == 1)? first: first / 2;
+
+            const auto& small = pattern(0, step);
+            auto position = start_of(small, offset);
+            for (auto index = static_cast<uint64_t>(0); index < number_of_bytes;) {
+                const auto count = std::min(small.size() - position, number_of_bytes - index);
+                std::memcpy(bytes + index, small.data() + position, count);
+                index += count;
+                position = 0;
+            }
+
+            const auto& large = pattern(1, step);
+            position = start_of(large, offset);
+            for (auto index = static_cast<uint64_t>(0); index < number_of_bytes; ++index) {
+                bytes[index] &= large[position];
+                if (++position == large.size()) {
+                    position = 0;
+                }
+            }
+
+            if (step == 1) {
+                // bit j represents an even number when first + j is even
+                const auto odd_mask = static_cast<uint8_t>((first % 2 == 0)? 0xaa: 0x55);
+                for (auto index = static_cast<uint64_t>(0); index < number_of_bytes; ++index) {
+                    bytes[index] &= odd_mask;
+                }
+            }
+#endif
+
+            // the pre-sieved primes itself are primes
+            for (const auto prime: {2, 3, 5, 7, 11, 13, 17, 19}) {
+                const auto number = static_cast<uint64_t>(prime);
+                if (number >= first && (number - first) % step == 0 && (number - first) / step < number_of_bits) {
+                    const auto bit = (number - first) / step;
+                    words[bit / 64] |= static_cast<uint64_t>(1) << (bit % 64);
+                }
+            }
+
+            if (number_of_bits % 64 != 0) {
+                words[number_of_bits / 64] &= (static_cast<uint64_t>(1) << (number_of_bits % 64)) - 1;
+            }
+        }
+
+        /// Initializing the states of a @ref types::bitset (see apply for the words).
+        static void apply(types::bitset<uint64_t>& container, const uint64_t number_of_bits,
+                          const uint64_t first, const uint64_t step) {
+            apply(container.data(), std::min(number_of_bits, container.size()), first, step);
+        }
+
+        /// Initializing the states of any container (like std::vector<bool>)
+        /// without word access striking out the multiples of the primes.
+        template <typename C>
+        static void apply(C& container, const uint64_t number_of_bits, const uint64_t first, const uint64_t step) {
+            const auto bits = std::min(number_of_bits, static_cast<uint64_t>(container.size()));
+            for (auto bit = static_cast<uint64_t>(0); bit < bits; ++bit) {
+                container[bit] = true;
+            }
+            strike([&container](const uint64_t bit) {container[bit] = false;}, bits, first, step);
+        }
+
+    private:
+        /// Striking out the multiples of the pre-sieved primes (not the primes itself).
+        /// @param clear function clearing a bit
+        template <typename F>
+        static void strike(F clear, const uint64_t number_of_bits, const uint64_t first, const uint64_t step) {
+            const auto last = first + step * (number_of_bits - 1);
+            for (const auto prime: {2, 3, 5, 7, 11, 13, 17, 19}) {
+                const auto p = static_cast<uint64_t>(prime);
+                if (p == 2 && step == 2) {
+                    continue;
+                }
+                // first multiple >= first represented by a bit (odd multiple for step 2)
+                auto multiple = first + (p - first % p) % p;
+                if ((multiple - first) % step != 0) {
+                    multiple += p;
+                }
+                for (; multiple <= last; multiple += p * step) {
+                    if (multiple != p) {
+                        clear((multiple - first) / step);
+                    }
+                }
+            }
+        }
+
+        /// @return byte of the pattern where the number (step 1) or odd index (step 2) is bit 0
+        static uint64_t start_of(const std::vector<uint8_t>& bytes, const uint64_t offset) noexcept {
+            const auto period = static_cast<uint64_t>(bytes.size());
+            // inverse of 8 modulo the odd period
+            const auto half = (period + 1) / 2;
+            const auto inverse_of_eight = half * half % period * half % period;
+            return (offset % period) * inverse_of_eight % period;
+        }
+
+        /// @param group 0 for the primes 3 up to 13, 1 for 17 and 19
+        /// @param step 1 when the bits represent all numbers, 2 for odd numbers only
+        /// @return byte pattern (built once)
+        static const std::vector<uint8_t>& pattern(const int group, const uint64_t step) {
+            static const std::vector<uint8_t> patterns[2][2] = {
+                {build({3, 5, 7, 11, 13}, 1), build({17, 19}, 1)},
+                {build({3, 5, 7, 11, 13}, 2), build({17, 19}, 2)}
+            };
+            return patterns[(step == 1)? 0: 1][group];
+        }
+
+        /// @return pattern of P bytes (P is the product of the primes) where bit t is set when the
+        ///         number represented (t for step 1, 2t+1 for step 2) is no multiple of the primes
+        static std::vector<uint8_t> build(const std::vector<uint64_t>& primes, const uint64_t step) {
+            auto period = static_cast<uint64_t>(1);
+            for (const auto prime: primes) {
+                period *= prime;
+            }
+
+            std::vector<uint8_t> bytes(period, 0);
+            for (auto bit = static_cast<uint64_t>(0); bit < 8 * period; ++bit) {
+                const auto number = (step == 1)? bit: 2 * bit + 1;
+                if (std::none_of(primes.begin(), primes.end(),
+                                 [number](const uint64_t prime) {return number % prime == 0;})) {
+                    bytes[bit / 8] |= static_cast<uint8_t>(1 << (bit % 8));
+                }
+            }
+            return bytes;
+        }
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_PRE_SIEVE_H_
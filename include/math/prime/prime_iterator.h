@@ -0,0 +1,122 @@
+///
+/// @author  Thomas Lehmann
+/// @file    prime_iterator.h
+/// @brief   forward iterator over the primes of a sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_PRIME_ITERATOR_H_
+#define INCLUDE_MATH_PRIME_PRIME_ITERATOR_H_
+
+#include <iterator>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class prime_iterator
+/// @brief forward iterator visiting the primes of a calculated sieve in increasing order.
+///
+/// The sieve has to provide <b>next_prime(number)</b> (smallest prime >= number
+/// or max_number() + 1 when there is none) and <b>max_number()</b>.
+///
+/// @code
+/// math::prime::sieve_of_eratosthenes<types::bitset<uint64_t>> sieve(100);
+/// sieve.calculate();
+/// for (const auto prime: sieve) {
+///     std::cout << prime << std::endl;
+/// }
+/// @endcode
+template <typename S>
+class prime_iterator final {
+    public:
+        /// iterator category
+        using iterator_category = std::forward_iterator_tag;
+        /// type of the primes
+        using value_type = uint64_t;
+        /// type for distance between two iterators
+        using difference_type = std::ptrdiff_t;
+        /// pointer to a prime
+        using pointer = const value_type*;
+        /// reference to a prime
+        using reference = const value_type&;
+
+        /// init c'tor
+        /// @param sieve the calculated sieve to iterate
+        /// @param value current prime (or max_number() + 1 for end)
+        prime_iterator(const S* sieve, const value_type value) noexcept
+            : m_sieve(sieve), m_value(value) {}
+
+        /// @return current prime
+        inline reference operator * () const noexcept {
+            return m_value;
+        }
+
+        /// moving to next prime
+        /// @return iterator itself for further operations
+        inline prime_iterator& operator ++ () noexcept {
+            m_value = m_sieve->next_prime(m_value + 1);
+            return *this;
+        }
+
+        /// moving to next prime
+        /// @return iterator before the increment
+        inline prime_iterator operator ++ (int) noexcept {
+            const auto previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        /// @return true when both iterators point to same prime
+        inline friend bool operator == (const prime_iterator& lhs, const prime_iterator& rhs) noexcept {
+            return lhs.m_value == rhs.m_value;
+        }
+
+        /// @return true when both iterators point to different primes
+        inline friend bool operator != (const prime_iterator& lhs, const prime_iterator& rhs) noexcept {
+            return lhs.m_value != rhs.m_value;
+        }
+
+    private:
+        /// the sieve providing the primes
+        const S* m_sieve;
+        /// current prime
+        value_type m_value;
+};
+
+/// Calling given function for each prime in [from, to] as known by given sieve.
+/// With a concrete (final) sieve type there is no virtual call at all.
+///
+/// @param sieve the calculated sieve
+/// @param from first number to check
+/// @param to last number to check
+/// @param function called with each prime found
+template <typename S, typename F>
+inline void for_each_prime(const S& sieve, const uint64_t from, const uint64_t to, F function) {
+    const auto last = std::min(to, sieve.max_number());
+    for (auto prime = sieve.next_prime(from); prime <= last; prime = sieve.next_prime(prime + 1)) {
+        function(prime);
+    }
+}
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_PRIME_ITERATOR_H_
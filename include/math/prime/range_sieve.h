@@ -0,0 +1,179 @@
+///
+/// @author  Thomas Lehmann
+/// @file    range_sieve.h
+/// @brief   prime sieve for a window [a, b] far above zero
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_RANGE_SIEVE_H_
+#define INCLUDE_MATH_PRIME_RANGE_SIEVE_H_
+
+#include <math/isqrt.h>
+#include <math/prime/sieve_interface.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <math/prime/pre_sieve.h>
+#include <math/prime/prime_iterator.h>
+#include <types/bitset.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class range_sieve
+/// @brief prime sieve for the window [min_n, max_n] only (offset range sieve).
+///
+/// Only the odd numbers of the window are stored: index i represents the
+/// number first + 2i where first is the smallest odd number >= min_n.
+/// The multiples of the smallest primes are striked out by @ref pre_sieve;
+/// the other base primes up to \f$\sqrt{max\_n}\f$ are taken from a small
+/// sieve and each of them strikes out its odd multiples inside the window only.
+/// The memory is proportional to the width of the window (plus the small
+/// sieve of the base primes).
+///
+/// @code
+/// // the primes in [10^15, 10^15 + 1000]
+/// math::prime::range_sieve<types::bitset<uint64_t>> sieve(1000000000000000, 1000000000001000);
+/// sieve.calculate();
+/// sieve.for_each_prime(sieve.min_number(), sieve.max_number(), [](const uint64_t prime) {...});
+/// @endcode
+///
+/// @note numbers outside of the window are never a prime.
+/// @note max_n has to be less than the maximum of uint64_t.
+template <typename T>
+class range_sieve final : public sieve_interface<T> {
+    public:
+        /// type of container for keeping true false states
+        using container_type = typename sieve_interface<T>::container_type;
+        /// type for the numbers in the calculation
+        using value_type = uint64_t;
+        /// type of iterator over the primes of the sieve (no virtual calls)
+        using iterator = prime_iterator<range_sieve>;
+
+        /// init c'tor which defines the window of numbers that can be
+        /// checked to be a prime (or not)
+        /// @param min_n smallest number of the window
+        /// @param max_n biggest number of the window
+        range_sieve(const value_type min_n, const value_type max_n)
+            : sieve_interface<T>(), m_min_n(min_n), m_max_n(max_n), m_first(min_n | 1)
+            , m_size((max_n >= (min_n | 1))? (max_n - (min_n | 1)) / 2 + 1: 0)
+            , m_is_prime(m_size + 1, true) {
+                m_is_prime[m_size] = false;
+                if (m_first == 1 && m_size > 0) {
+                    m_is_prime[0] = false;
+                }
+            }
+
+        /// striking out the odd multiples of all base primes inside the window.
+        void calculate() noexcept override {
+            // multiples of 3 up to 19 are striked out by tiling a pattern
+            pre_sieve::apply(m_is_prime, m_size, m_first, 2);
+            if (m_first == 1 && m_size > 0) {
+                m_is_prime[0] = false;
+            }
+
+            const auto limit = isqrt(m_max_n);
+            if (m_size == 0 || limit < pre_sieve::NEXT_PRIME) {
+                return;
+            }
+
+            sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> base_sieve(limit);
+            base_sieve.calculate();
+            base_sieve.for_each_prime(pre_sieve::NEXT_PRIME, limit, [this](const value_type prime) {
+                // first odd multiple of the prime inside the window (not the prime itself)
+                auto multiple = std::max(prime * prime, m_first + (prime - m_first % prime) % prime);
+                if (multiple % 2 == 0) {
+                    multiple += prime;
+                }
+
+                if (multiple <= m_max_n) {
+                    for (auto index = (multiple - m_first) / 2; index < m_size; index += prime) {
+                        m_is_prime[index] = false;
+                    }
+                }
+            });
+        }
+
+        /// @return true when given number is a prime (false when outside of the window)
+        bool is_prime(const typename container_type::size_type number) const noexcept override {
+            if (number < m_min_n || number > m_max_n) {
+                return false;
+            }
+            if (number % 2 == 0) {
+                return number == 2;
+            }
+            return m_is_prime[(number - m_first) / 2];
+        }
+
+        /// @return the smallest number that can be checked to be a prime
+        value_type min_number() const noexcept {
+            return m_min_n;
+        }
+
+        /// @return the biggest number that can be checked to be a prime
+        value_type max_number() const noexcept override {
+            return m_max_n;
+        }
+
+        /// @return smallest prime >= given number (and inside the window) or max_number() + 1 when there is none
+        value_type next_prime(const value_type number) const noexcept override {
+            const auto start = std::max(number, m_min_n);
+            if (start <= 2 && m_max_n >= 2) {
+                return 2;
+            }
+
+            // index for start or the next odd number behind it
+            const auto index = types::find_next(m_is_prime, (std::max(start, m_first) - m_first + 1) / 2);
+            return (index < m_size)? m_first + 2 * static_cast<value_type>(index): m_max_n + 1;
+        }
+
+        /// @return iterator for the first prime
+        iterator begin() const noexcept {
+            return iterator(this, next_prime(m_min_n));
+        }
+
+        /// @return iterator behind the last prime
+        iterator end() const noexcept {
+            return iterator(this, max_number() + 1);
+        }
+
+        /// Calling given function for each prime in [from, to] (limited to the window).
+        template <typename F>
+        void for_each_prime(const value_type from, const value_type to, F function) const {
+            prime::for_each_prime(*this, from, to, function);
+        }
+
+    private:
+        /// the smallest number that can be checked to be a prime
+        const value_type m_min_n;
+        /// the biggest number that can be checked to be a prime
+        const value_type m_max_n;
+        /// the smallest odd number >= m_min_n (represented by index 0)
+        const value_type m_first;
+        /// number of odd numbers in the window
+        const value_type m_size;
+        /// container for keeping true/false states of the odd numbers in the window
+        /// (plus one false state: a container cannot be empty)
+        container_type m_is_prime;
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_RANGE_SIEVE_H_
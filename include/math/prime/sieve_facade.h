@@ -0,0 +1,128 @@
+///
+/// @author  Thomas Lehmann
+/// @file    sieve_facade.h
+/// @brief   static dispatch (CRTP) facade for sieves with batched prime checks
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_SIEVE_FACADE_H_
+#define INCLUDE_MATH_PRIME_SIEVE_FACADE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class sieve_facade
+/// @brief static dispatch (CRTP) facade for sieves.
+///
+/// The lookups of this facade are non virtual and without any exception
+/// handling or branch so they can be inlined and vectorised. The virtual
+/// @ref sieve_interface is still there for pluggability.
+///
+/// The derived sieve D has to provide:
+///  - <b>enum {ODD_NUMBERS_ONLY = ...}</b>: true when the states are for odd numbers only
+///    (index n represents number 2n+1) otherwise index n represents number n.
+///  - <b>max_number()</b>: the biggest number that can be checked to be a prime.
+///  - <b>state(index)</b>: state for given index (without range check).
+///  - <b>gather(indices, count, results)</b>: states for given indices (without range check).
+///
+/// @code
+/// math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(1000000);
+/// sieve.calculate();
+///
+/// const std::vector<uint64_t> candidates = {999983, 999985, 2000003};
+/// std::vector<uint8_t> results(candidates.size());
+/// sieve.is_prime_batch(candidates.data(), candidates.size(), results.data());  // 1, 0, 0
+/// @endcode
+template <typename D>
+class sieve_facade {
+    public:
+        /// @return true when given number is a prime (false when behind max. number)
+        inline bool lookup(const uint64_t number) const noexcept {
+            const auto& sieve = static_cast<const D&>(*this);
+            const auto max_number = sieve.max_number();
+            const auto in_range = number <= max_number;
+            const auto index = to_index(std::min(number, max_number));
+
+            if (D::ODD_NUMBERS_ONLY) {
+                return ((number == 2) & (max_number >= 2))
+                     | (in_range & ((number & 1) == 1) & static_cast<bool>(sieve.state(index)));
+            }
+            return in_range & static_cast<bool>(sieve.state(index));
+        }
+
+        /// Checking many numbers at once: the numbers are mapped to indices
+        /// (clamped to the limit), the states are gathered (with SIMD when
+        /// available) and finally masked by the range check.
+        ///
+        /// @param numbers numbers to check
+        /// @param count number of numbers
+        /// @param results [out] 1 for a prime and 0 for a none prime for each number
+        void is_prime_batch(const uint64_t* numbers, const std::size_t count, uint8_t* results) const noexcept {
+            const auto& sieve = static_cast<const D&>(*this);
+            const auto max_number = sieve.max_number();
+
+            uint64_t indices[CHUNK_SIZE];
+            for (auto offset = static_cast<std::size_t>(0); offset < count; offset += CHUNK_SIZE) {
+                const auto chunk = std::min(static_cast<std::size_t>(CHUNK_SIZE), count - offset);
+                const auto chunk_numbers = numbers + offset;
+                const auto chunk_results = results + offset;
+
+                for (auto position = static_cast<std::size_t>(0); position < chunk; ++position) {
+                    indices[position] = to_index(std::min(chunk_numbers[position], max_number));
+                }
+
+                sieve.gather(indices, chunk, chunk_results);
+
+                for (auto position = static_cast<std::size_t>(0); position < chunk; ++position) {
+                    const auto number = chunk_numbers[position];
+                    const auto in_range = static_cast<uint8_t>(number <= max_number);
+                    if (D::ODD_NUMBERS_ONLY) {
+                        chunk_results[position] = static_cast<uint8_t>(
+                            (chunk_results[position] & in_range & static_cast<uint8_t>(number & 1))
+                            | ((number == 2) & (max_number >= 2)));
+                    } else {
+                        chunk_results[position] &= in_range;
+                    }
+                }
+            }
+        }
+
+    protected:
+        /// only derived sieves can be created and destroyed
+        sieve_facade() = default;
+        /// no virtual d'tor required (never deleted via facade)
+        ~sieve_facade() = default;
+
+    private:
+        /// number of indices calculated at once
+        enum {CHUNK_SIZE = 256};
+
+        /// @return index of the state for given number
+        static inline uint64_t to_index(const uint64_t number) noexcept {
+            return D::ODD_NUMBERS_ONLY? number / 2: number;
+        }
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_SIEVE_FACADE_H_
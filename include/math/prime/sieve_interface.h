@@ -23,6 +23,9 @@
 #ifndef INCLUDE_MATH_PRIME_SIEVE_INTERFACE_H_
 #define INCLUDE_MATH_PRIME_SIEVE_INTERFACE_H_
 
+#include <math/prime/prime_iterator.h>
+#include <cstdint>
+
 namespace math {
 namespace prime {
 
@@ -33,13 +36,39 @@ class sieve_interface {
     public:
         /// type of container for keeping true false states
         using container_type = T;
+        /// type of iterator over the primes of the sieve
+        using iterator = prime_iterator<sieve_interface>;
+
         /// required because of derived classes only
         virtual ~sieve_interface() = default;
 
         /// starts sieve calculation
-        virtual void calculate() noexcept = 0;
+        /// @note not noexcept: sieves allocating their states on calculation may throw std::bad_alloc
+        virtual void calculate() = 0;
         /// @return true when given number is a prime
         virtual bool is_prime(const typename container_type::size_type number) const noexcept = 0;
+        /// @return the biggest number that can be checked to be a prime
+        virtual uint64_t max_number() const noexcept = 0;
+        /// @return smallest prime >= given number or max_number() + 1 when there is none
+        virtual uint64_t next_prime(const uint64_t number) const noexcept = 0;
+
+        /// @return iterator for the first prime
+        iterator begin() const noexcept {
+            return iterator(this, next_prime(0));
+        }
+
+        /// @return iterator behind the last prime
+        iterator end() const noexcept {
+            return iterator(this, max_number() + 1);
+        }
+
+        /// Calling given function for each prime in [from, to].
+        /// @note costs one virtual call per prime; use the concrete sieve
+        ///       for avoiding it.
+        template <typename F>
+        void for_each_prime(const uint64_t from, const uint64_t to, F function) const {
+            prime::for_each_prime(*this, from, to, function);
+        }
 };
 
 }  // namespace prime
@@ -24,6 +24,10 @@
 #define INCLUDE_MATH_PRIME_SIEVE_OF_ERATOSTENES_H_
 
 #include <math/prime/sieve_interface.h>
+#include <math/prime/sieve_facade.h>
+#include <math/prime/pre_sieve.h>
+#include <math/prime/prime_iterator.h>
+#include <types/bitset.h>
 #include <stdexcept>
 #include <cmath>
 
@@ -43,12 +47,16 @@ namespace prime {
 /// @note the algorithm is also not sensible enough to avoid
 ///       striking out a none prime more than once.
 template <typename T>
-class sieve_of_eratosthenes final : public sieve_interface<T> {
+class sieve_of_eratosthenes final : public sieve_interface<T>, public sieve_facade<sieve_of_eratosthenes<T>> {
     public:
         /// type of container for keeping true false states
         using container_type = typename sieve_interface<T>::container_type;
         /// type for the numbers in the calculation
         using value_type = uint64_t;
+        /// type of iterator over the primes of the sieve (no virtual calls)
+        using iterator = prime_iterator<sieve_of_eratosthenes>;
+        /// layout of the states (see @ref sieve_facade)
+        enum {ODD_NUMBERS_ONLY = false};
 
         /// init c'tor which defines the maximum number that can
         /// be checked to be a prime (or not)
@@ -64,7 +72,12 @@ class sieve_of_eratosthenes final : public sieve_interface<T> {
             auto max_limit = static_cast<value_type>(m_is_prime.size());
             auto min_limit = static_cast<value_type>(sqrt(max_limit));
 
-            for (value_type i = 2; i <= min_limit; ++i) {
+            // multiples of 2 up to 19 are striked out by tiling a pattern
+            pre_sieve::apply(m_is_prime, max_limit, 0, 1);
+            m_is_prime[0] = false;
+            m_is_prime[1] = false;
+
+            for (value_type i = pre_sieve::NEXT_PRIME; i <= min_limit; ++i) {
                 if (m_is_prime[i]) {
                     for (value_type j = i*i; j < max_limit; j += i) {
                         m_is_prime[j] = false;
@@ -73,13 +86,51 @@ class sieve_of_eratosthenes final : public sieve_interface<T> {
             }
         }
 
-        /// @return true when given number is a prime
+        /// @return true when given number is a prime (false when behind max. number)
         bool is_prime(const typename container_type::size_type number) const noexcept override {
-            try {
-                return m_is_prime[number];
-            } catch (const std::exception& e) {
-                return false;
-            }
+            return this->lookup(number);
+        }
+
+        /// @return state for given index (no range check; see @ref sieve_facade)
+        inline bool state(const value_type index) const noexcept {
+            return m_is_prime[index];
+        }
+
+        /// reading states for given indices (no range check; see @ref sieve_facade)
+        inline void gather(const uint64_t* indices, const std::size_t count, uint8_t* results) const noexcept {
+            types::gather(m_is_prime, indices, count, results);
+        }
+
+        /// @return the biggest number that can be checked to be a prime
+        value_type max_number() const noexcept override {
+            return static_cast<value_type>(m_is_prime.size()) - 1;
+        }
+
+        /// Scanning for next prime; with @ref types::bitset as container whole
+        /// words are skipped at once jumping to the next set bit.
+        /// @return smallest prime >= given number or max_number() + 1 when there is none
+        value_type next_prime(const value_type number) const noexcept override {
+            return types::find_next(m_is_prime, number);
+        }
+
+        /// @return iterator for the first prime
+        iterator begin() const noexcept {
+            return iterator(this, next_prime(0));
+        }
+
+        /// @return iterator behind the last prime
+        iterator end() const noexcept {
+            return iterator(this, max_number() + 1);
+        }
+
+        /// Calling given function for each prime in [from, to].
+        /// @code
+        /// std::vector<uint64_t> primes;
+        /// sieve.for_each_prime(100, 200, [&primes](const uint64_t prime) {primes.push_back(prime);});
+        /// @endcode
+        template <typename F>
+        void for_each_prime(const value_type from, const value_type to, F function) const {
+            prime::for_each_prime(*this, from, to, function);
         }
 
     private:
@@ -24,6 +24,10 @@
 #define INCLUDE_MATH_PRIME_SIEVE_OF_ERATOSTENES_OPTIMIZED_H_
 
 #include <math/prime/sieve_interface.h>
+#include <math/prime/sieve_facade.h>
+#include <math/prime/pre_sieve.h>
+#include <math/prime/prime_iterator.h>
+#include <types/bitset.h>
 #include <stdexcept>
 #include <cmath>
 
@@ -40,19 +44,22 @@ namespace prime {
 /// @note the algorithm is also not sensible enough to avoid
 ///       striking out a none prime more than once.
 template <typename T>
-class sieve_of_eratosthenes_optimized final : public sieve_interface<T> {
+class sieve_of_eratosthenes_optimized final : public sieve_interface<T>, public sieve_facade<sieve_of_eratosthenes_optimized<T>> {
     public:
         /// type of container for keeping true false states
         using container_type = typename sieve_interface<T>::container_type;
         /// type for the numbers in the calculation
         using value_type = uint64_t;
+        /// type of iterator over the primes of the sieve (no virtual calls)
+        using iterator = prime_iterator<sieve_of_eratosthenes_optimized>;
+        /// layout of the states (see @ref sieve_facade)
+        enum {ODD_NUMBERS_ONLY = true};
 
         /// init c'tor which defines the maximum number that can
         /// be checked to be a prime (or not)
         sieve_of_eratosthenes_optimized(value_type max_n)
-            : sieve_interface<T>(), m_max_n(max_n), m_is_prime(max_n/2, true) {
+            : sieve_interface<T>(), m_max_n(max_n), m_is_prime(max_n/2 + 1, true) {
                 m_is_prime[0] = false;
-                m_is_prime[1] = true;
             }
 
         /// calculating the prime states striking out all multiples of a
@@ -61,30 +68,76 @@ class sieve_of_eratosthenes_optimized final : public sieve_interface<T> {
             auto max_limit = static_cast<value_type>(m_max_n);
             auto min_limit = static_cast<value_type>(sqrt(m_max_n));
 
-            for (value_type i = 3; i <= min_limit; i += 2) {
+            // multiples of 3 up to 19 are striked out by tiling a pattern
+            pre_sieve::apply(m_is_prime, m_is_prime.size(), 1, 2);
+            m_is_prime[0] = false;
+
+            for (value_type i = pre_sieve::NEXT_PRIME; i <= min_limit; i += 2) {
                 if (m_is_prime[i/2]) {
                     const auto offset = 2*i;
-                    for (value_type j = i*i; j < max_limit; j += offset) {
+                    for (value_type j = i*i; j <= max_limit; j += offset) {
                         m_is_prime[j/2] = false;
                     }
                 }
             }
         }
 
-        /// @return true when given number is a prime
+        /// @return true when given number is a prime (false when behind max. number)
         bool is_prime(const typename container_type::size_type number) const noexcept override {
-            if (number % 2 == 0) {
-                return 2 == number;
-            }
+            return this->lookup(number);
+        }
+
+        /// @return state for given index (no range check; see @ref sieve_facade)
+        inline bool state(const value_type index) const noexcept {
+            return m_is_prime[index];
+        }
+
+        /// reading states for given indices (no range check; see @ref sieve_facade)
+        inline void gather(const uint64_t* indices, const std::size_t count, uint8_t* results) const noexcept {
+            types::gather(m_is_prime, indices, count, results);
+        }
+
+        /// @return the biggest number that can be checked to be a prime
+        value_type max_number() const noexcept override {
+            return m_max_n;
+        }
 
-            try {
-                return m_is_prime[number / 2];
-            } catch (const std::exception& e) {
-                return false;
+        /// Scanning for next prime; with @ref types::bitset as container whole
+        /// words are skipped at once jumping to the next set bit.
+        /// @return smallest prime >= given number or max_number() + 1 when there is none
+        value_type next_prime(const value_type number) const noexcept override {
+            if (number <= 2) {
+                return (m_max_n >= 2)? 2: m_max_n + 1;
             }
+
+            // index n/2 represents the odd number n (or n+1 when n is even)
+            const auto index = types::find_next(m_is_prime, number / 2);
+            const auto prime = 2 * static_cast<value_type>(index) + 1;
+            return (prime <= m_max_n)? prime: m_max_n + 1;
+        }
+
+        /// @return iterator for the first prime
+        iterator begin() const noexcept {
+            return iterator(this, next_prime(0));
+        }
+
+        /// @return iterator behind the last prime
+        iterator end() const noexcept {
+            return iterator(this, max_number() + 1);
+        }
+
+        /// Calling given function for each prime in [from, to].
+        /// @code
+        /// std::vector<uint64_t> primes;
+        /// sieve.for_each_prime(100, 200, [&primes](const uint64_t prime) {primes.push_back(prime);});
+        /// @endcode
+        template <typename F>
+        void for_each_prime(const value_type from, const value_type to, F function) const {
+            prime::for_each_prime(*this, from, to, function);
         }
 
     private:
+        /// the biggest number that can be checked to be a prime
         value_type m_max_n;
         /// container for keeping true/false states
         container_type m_is_prime;
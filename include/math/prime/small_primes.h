@@ -0,0 +1,263 @@
+///
+/// @author  Thomas Lehmann
+/// @file    small_primes.h
+/// @brief   compile time tables of the primes below 65536
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_SMALL_PRIMES_H_
+#define INCLUDE_MATH_PRIME_SMALL_PRIMES_H_
+
+#include <types/type_traits.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @struct small_primes_generator
+/// @brief constexpr functions (C++11: one return statement each) for
+///        generating the tables of @ref small_primes_table.
+///
+/// Each word of the bitmap (odd numbers only) is built striking out the
+/// odd multiples of the odd numbers d with \f$d^2\f$ inside the word (a
+/// small sieve per word). The list of primes is selected from the finished
+/// bitmap with the help of the counts per word (binary search). All
+/// recursions are bound by 128 steps or divide a range into halves staying
+/// below the constexpr depth limit of the compilers (512); the number of
+/// calls is kept small for the compile time.
+struct small_primes_generator final {
+    /// @return given bits repeated with a distance of d, 2d, 4d, ... (doubling until the word is filled)
+    static constexpr uint64_t repeat(const uint64_t bits, const uint64_t distance) noexcept {
+        return distance >= 64? bits: repeat(bits | (bits << distance), 2 * distance);
+    }
+
+    /// @return first bit (may be behind the word) of an odd multiple m of d with \f$m \ge d^2\f$
+    ///         for the word where bit b represents the odd number base + 2b
+    static constexpr uint64_t first_bit(const uint64_t base, const uint64_t d) noexcept {
+        return d * d >= base? (d * d - base) / 2: (d - base % d) % d * ((d + 1) / 2) % d;
+    }
+
+    /// @return bits for the odd multiples m of d with \f$m \ge d^2\f$ for the word where
+    ///         bit b represents the odd number base + 2b
+    static constexpr uint64_t multiples(const uint64_t d, const uint64_t bit) noexcept {
+        return bit >= 64? 0: repeat(static_cast<uint64_t>(1) << bit, d);
+    }
+
+    /// @return bits for the odd multiples of the odd primes d, d + 2, ... (as long as \f$d^2\f$
+    ///         is inside the word) for the word where bit b represents the odd number base + 2b
+    /// @param primes the odd primes below 256 (bit b represents 2b + 1)
+    static constexpr uint64_t composites(const uint64_t base, const uint64_t d,
+                                         const uint64_t (&primes)[2]) noexcept {
+        return d * d >= base + 128? 0
+             : (((primes[d / 128] >> (d / 2 % 64)) & 1) == 1? multiples(d, first_bit(base, d)): 0)
+               | composites(base, d + 2, primes);
+    }
+
+    /// @return bits for the odd numbers base + 2b which are no multiple of 3, 5, 7, 11 and 13
+    static constexpr uint64_t coprimes(const uint64_t base) noexcept {
+        return ~(multiples(3, first_bit(base, 3)) | multiples(5, first_bit(base, 5)) | multiples(7, first_bit(base, 7))
+                 | multiples(11, first_bit(base, 11)) | multiples(13, first_bit(base, 13)));
+    }
+
+    /// @return word of the bitmap (bit b represents the odd number 128 * index + 2b + 1);
+    ///         1 is not a prime
+    /// @param primes the odd primes below 256 (bit b represents 2b + 1)
+    static constexpr uint64_t word(const uint64_t index, const uint64_t (&primes)[2]) noexcept {
+        return index < 2? primes[index]: ~composites(128 * index + 1, 3, primes);
+    }
+
+    /// @return number of set bits (counting bits in parallel: 2, 4, 8 bits and finally all bytes)
+    static constexpr uint64_t population_count(const uint64_t value) noexcept {
+        return sum_of_nibbles(value - ((value >> 1) & 0x5555555555555555));
+    }
+
+    /// @return number of set bits for given 2 bit counts
+    static constexpr uint64_t sum_of_nibbles(const uint64_t pairs) noexcept {
+        return sum_of_bytes((pairs & 0x3333333333333333) + ((pairs >> 2) & 0x3333333333333333));
+    }
+
+    /// @return number of set bits for given 4 bit counts
+    static constexpr uint64_t sum_of_bytes(const uint64_t nibbles) noexcept {
+        return (((nibbles + (nibbles >> 4)) & 0x0f0f0f0f0f0f0f0f) * 0x0101010101010101) >> 56;
+    }
+
+    /// @return number of set bits of the words [lo, hi)
+    template <std::size_t N>
+    static constexpr uint64_t count(const uint64_t (&words)[N], const uint64_t lo, const uint64_t hi) noexcept {
+        return hi - lo == 0? 0: (hi - lo == 1? population_count(words[lo])
+                                             : count(words, lo, (lo + hi) / 2) + count(words, (lo + hi) / 2, hi));
+    }
+
+    /// @return number of set bits of the words [0, end); the words are counted in
+    ///         aligned blocks of power of two sizes (the compiler caches the block counts)
+    template <std::size_t N>
+    static constexpr uint64_t count_before(const uint64_t (&words)[N], const uint64_t end) noexcept {
+        return end == 0? 0: count_before(words, end & (end - 1)) + count(words, end & (end - 1), end);
+    }
+
+    /// @return index of lowest set bit (value may not be 0)
+    static constexpr uint64_t trailing_zeros(const uint64_t value) noexcept {
+        return population_count((value & (~value + 1)) - 1);
+    }
+
+    /// @return index of the nth set bit (counting from 0) of given value
+    static constexpr uint64_t select_bit(const uint64_t value, const uint64_t nth) noexcept {
+        return nth == 0? trailing_zeros(value): select_bit(value & (value - 1), nth - 1);
+    }
+
+    /// @return last word in [lo, hi) with less than nth + 1 set bits before it (binary search)
+    template <std::size_t N>
+    static constexpr uint64_t find_word(const uint16_t (&counts)[N], const uint64_t nth,
+                                        const uint64_t lo, const uint64_t hi) noexcept {
+        return hi - lo == 1? lo: (counts[(lo + hi) / 2] <= nth? find_word(counts, nth, (lo + hi) / 2, hi)
+                                                               : find_word(counts, nth, lo, (lo + hi) / 2));
+    }
+
+    /// @return index of the nth set bit (counting from 0) of the words
+    template <std::size_t N>
+    static constexpr uint64_t select(const uint64_t (&words)[N], const uint16_t (&counts)[N],
+                                     const uint64_t nth, const uint64_t index) noexcept {
+        return 64 * index + select_bit(words[index], nth - counts[index]);
+    }
+
+    /// @return R initialized with the words 0, 1, ..., N-1 of the bitmap
+    template <typename R, std::size_t... I>
+    static constexpr R make_bitmap(types::index_sequence<I...>) noexcept {
+        return make_bitmap<R>(types::index_sequence<I...>(), {coprimes(1) & ~static_cast<uint64_t>(1), coprimes(129)});
+    }
+
+    /// @return R initialized with the words 0, 1, ..., N-1 of the bitmap
+    /// @param primes the odd primes below 256 (the multiples of 3, 5, 7, 11, 13 are striked out only)
+    template <typename R, std::size_t... I>
+    static constexpr R make_bitmap(types::index_sequence<I...>, const uint64_t (&primes)[2]) noexcept {
+        return R{{word(I, {primes[0] | 0x6e, primes[1]})...}};
+    }
+
+    /// @return R initialized with the number of set bits before word 0, 1, ..., N-1
+    template <typename R, std::size_t N, std::size_t... I>
+    static constexpr R make_counts(types::index_sequence<I...>, const uint64_t (&words)[N]) noexcept {
+        return R{{static_cast<uint16_t>(count_before(words, I))...}};
+    }
+
+    /// @return R initialized with 2 and the odd primes for the set bits 0, 1, ..., N-2
+    template <typename R, std::size_t N, std::size_t... I>
+    static constexpr R make_primes(types::index_sequence<I...>, const uint64_t (&words)[N],
+                                   const uint16_t (&counts)[N]) noexcept {
+        return R{{2, static_cast<uint16_t>(2 * select(words, counts, I, find_word(counts, I, 0, N)) + 1)...}};
+    }
+};
+
+/// @class small_primes_table
+/// @brief compile time generated primality bitmap and list of primes below 65536.
+///
+/// A lookup is one load and no table is built at runtime. The class is a
+/// template so the static tables can be defined in this header.
+///
+/// @code
+/// static_assert(math::prime::small_primes::is_prime(65521), "largest prime below 2^16");
+/// for (const auto prime: math::prime::small_primes::primes) {...}
+/// @endcode
+template <typename U = void>
+class small_primes_table final {
+    public:
+        /// all numbers below this limit are covered
+        enum {LIMIT = 65536};
+        /// number of primes below the limit
+        enum {COUNT = 6542};
+        /// number of words of the bitmap (odd numbers only)
+        enum {WORDS = LIMIT / 128};
+
+        /// primality bitmap (bit n%64 of word n/64 is set when 2n+1 is a prime)
+        struct bitmap_type final {
+            /// the words of the bitmap
+            uint64_t words[WORDS];
+        };
+
+        /// number of odd primes below 128 * n for each word n of the bitmap
+        struct counts_type final {
+            /// the counts
+            uint16_t values[WORDS];
+        };
+
+        /// the primes in increasing order
+        struct primes_type final {
+            /// the primes
+            uint16_t values[COUNT];
+
+            /// @return pointer to first prime
+            constexpr const uint16_t* begin() const noexcept {
+                return values;
+            }
+
+            /// @return pointer behind last prime
+            constexpr const uint16_t* end() const noexcept {
+                return values + COUNT;
+            }
+
+            /// @return nth prime (counting from 0)
+            constexpr uint16_t operator [] (const std::size_t nth) const noexcept {
+                return values[nth];
+            }
+        };
+
+        /// @return true when given number (< LIMIT) is a prime
+        static constexpr bool is_prime(const uint32_t number) noexcept {
+            return number == 2 || ((number & 1) == 1 && ((bitmap.words[number / 128] >> (number / 2 % 64)) & 1) == 1);
+        }
+
+        /// @return number of primes <= given number (< LIMIT)
+        static constexpr uint32_t count_primes(const uint32_t number) noexcept {
+            return number < 2? 0: 1 + counts.values[(number - 1) / 128] + static_cast<uint32_t>(
+                small_primes_generator::population_count(bitmap.words[(number - 1) / 128]
+                    & (~static_cast<uint64_t>(0) >> (63 - (number - 1) / 2 % 64))));
+        }
+
+        /// primality bitmap of the odd numbers below LIMIT
+        static constexpr bitmap_type bitmap =
+            small_primes_generator::make_bitmap<bitmap_type>(types::make_index_sequence<WORDS>());
+
+        /// number of odd primes before each word of the bitmap
+        static constexpr counts_type counts =
+            small_primes_generator::make_counts<counts_type>(types::make_index_sequence<WORDS>(), bitmap.words);
+
+        /// the primes below LIMIT
+        static constexpr primes_type primes =
+            small_primes_generator::make_primes<primes_type>(types::make_index_sequence<COUNT - 1>(),
+                                                             bitmap.words, counts.values);
+
+        /// we don't want to have instantiation
+        small_primes_table() = delete;
+};
+
+template <typename U>
+constexpr typename small_primes_table<U>::bitmap_type small_primes_table<U>::bitmap;
+
+template <typename U>
+constexpr typename small_primes_table<U>::counts_type small_primes_table<U>::counts;
+
+template <typename U>
+constexpr typename small_primes_table<U>::primes_type small_primes_table<U>::primes;
+
+/// the compile time tables of the primes below 65536
+using small_primes = small_primes_table<>;
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_SMALL_PRIMES_H_
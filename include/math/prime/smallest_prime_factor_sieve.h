@@ -0,0 +1,177 @@
+///
+/// @author  Thomas Lehmann
+/// @file    smallest_prime_factor_sieve.h
+/// @brief   linear sieve providing the smallest prime factor for each number
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_PRIME_SMALLEST_PRIME_FACTOR_SIEVE_H_
+#define INCLUDE_MATH_PRIME_SMALLEST_PRIME_FACTOR_SIEVE_H_
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace math {
+namespace prime {
+
+/// @class smallest_prime_factor_sieve
+/// @brief table of the smallest prime factor of each number up to max_n (linear sieve).
+///
+/// Each composite number is written exactly once: by its smallest prime factor
+/// p as p * i where i has no prime factor below p. Only odd numbers are stored
+/// (the smallest factor of an even number is 2) and since the smallest factor of
+/// an odd composite number below 2^32 is below 2^16 two bytes per odd number are
+/// enough; a 0 marks a prime. Factorizing a number needs O(log n) lookups then.
+///
+/// @code
+/// math::prime::smallest_prime_factor_sieve sieve(1000000);
+/// sieve.calculate();
+///
+/// math::prime::smallest_prime_factor_sieve::factors_type factors;
+/// sieve.factorize(360, factors);    // (2, 3), (3, 2), (5, 1)
+///
+/// math::prime::smallest_prime_factor_sieve::divisors_type divisors;
+/// sieve.divisors(12, divisors);     // 1, 2, 3, 4, 6, 12
+/// @endcode
+class smallest_prime_factor_sieve final {
+    public:
+        /// type for the numbers
+        using value_type = uint32_t;
+        /// prime factors with their exponents in increasing order of the primes
+        using factors_type = std::vector<std::pair<value_type, value_type>>;
+        /// type of container for divisors
+        using divisors_type = std::vector<value_type>;
+
+        /// init c'tor
+        /// @param max_n biggest number that can be factorized
+        explicit smallest_prime_factor_sieve(const value_type max_n)
+            : m_max_n(max_n), m_factors(max_n / 2 + 1, 0) {
+        }
+
+        /// linear sieve over the odd numbers
+        void calculate() {
+            // the primes p with p * p <= max_n (the only ones writing a factor)
+            std::vector<value_type> primes;
+            for (auto number = uint64_t(3); number <= m_max_n; number += 2) {
+                const auto factor = m_factors[number / 2];
+                if (factor == 0 && number * number <= m_max_n) {
+                    primes.push_back(static_cast<value_type>(number));
+                }
+
+                const auto smallest = factor == 0? number: factor;
+                for (const auto prime: primes) {
+                    if (prime > smallest || number * prime > m_max_n) {
+                        break;
+                    }
+                    m_factors[number * prime / 2] = static_cast<uint16_t>(prime);
+                }
+            }
+        }
+
+        /// @return biggest number that can be factorized
+        value_type max_number() const noexcept {
+            return m_max_n;
+        }
+
+        /// @param number number >= 2 and <= max_number()
+        /// @return smallest prime factor of given number
+        value_type smallest_prime_factor(const value_type number) const noexcept {
+            if (number % 2 == 0) {
+                return 2;
+            }
+            const auto factor = m_factors[number / 2];
+            return factor == 0? number: factor;
+        }
+
+        /// @param number number to factorize (0 and 1 do not have prime factors)
+        /// @param factors [out] prime factors with their exponents
+        /// @throw std::runtime_error when number is behind max_number()
+        void factorize(const value_type number, factors_type& factors) const {
+            factors.clear();
+            for_each_prime_power(number, [&factors](const value_type prime, const value_type exponent) {
+                factors.push_back(std::make_pair(prime, exponent));
+            });
+        }
+
+        /// @param number number for which to find all divisors
+        /// @param divisors [out] divisors in increasing order (empty for 0)
+        /// @throw std::runtime_error when number is behind max_number()
+        void divisors(const value_type number, divisors_type& divisors) const {
+            divisors.clear();
+            if (number == 0) {
+                return;
+            }
+
+            divisors.push_back(1);
+            for_each_prime_power(number, [&divisors](const value_type prime, const value_type exponent) {
+                // each known divisor multiplied by p, p^2, ..., p^exponent
+                const auto count = divisors.size();
+                auto power = value_type(1);
+                for (auto nth = value_type(0); nth < exponent; ++nth) {
+                    power *= prime;
+                    for (auto index = std::size_t(0); index < count; ++index) {
+                        divisors.push_back(divisors[index] * power);
+                    }
+                }
+            });
+            std::sort(divisors.begin(), divisors.end());
+        }
+
+    private:
+        /// calling function with each prime factor and its exponent (increasing order of primes)
+        template <typename F>
+        void for_each_prime_power(value_type number, F function) const {
+            if (number > m_max_n) {
+                throw std::runtime_error("number is behind the limit of the smallest prime factor sieve");
+            }
+
+            if (number == 0) {
+                return;
+            }
+
+            auto twos = value_type(0);
+            for (; number % 2 == 0; number /= 2) {
+                ++twos;
+            }
+            if (twos > 0) {
+                function(2, twos);
+            }
+
+            while (number > 1) {
+                const auto prime = smallest_prime_factor(number);
+                auto exponent = value_type(0);
+                for (; number % prime == 0; number /= prime) {
+                    ++exponent;
+                }
+                function(prime, exponent);
+            }
+        }
+
+        /// biggest number that can be factorized
+        value_type m_max_n;
+        /// smallest prime factor of each odd number (index n represents 2n+1, 0 for a prime)
+        std::vector<uint16_t> m_factors;
+};
+
+}  // namespace prime
+}  // namespace math
+
+#endif  // INCLUDE_MATH_PRIME_SMALLEST_PRIME_FACTOR_SIEVE_H_
@@ -0,0 +1,354 @@
+///
+/// @author  Thomas Lehmann
+/// @file    sum_fractions.h
+/// @brief   exact sum of many fractions by binary splitting.
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_MATH_SUM_FRACTIONS_H_
+#define INCLUDE_MATH_SUM_FRACTIONS_H_
+
+#include <math/big_integer.h>
+#include <math/binomial.h>
+#include <math/decimal_limbs.h>
+#include <math/factorize_u64.h>
+#include <math/fraction.h>
+
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace math {
+
+/// @class binary_splitting
+/// @brief combining a range of values pairwise in a balanced tree.
+///
+/// The operands of each combination have about the same size and the sizes
+/// grow level by level (fast multiplications pay off) while a sequential
+/// combination adds a small value to a huge one again and again. The left
+/// subtrees of the top levels are calculated by further threads.
+class binary_splitting final {
+    public:
+        /// no instances
+        binary_splitting() = delete;
+
+        /// @param first index of the first value
+        /// @param last index behind the last value (first < last)
+        /// @param threads number of threads to use (0 for one per core)
+        /// @param leaf function providing the value for an index
+        /// @param combine function combining the values of two neighboured ranges
+        /// @return combination of all values
+        template <typename T, typename Leaf, typename Combine>
+        static T reduce(const std::size_t first, const std::size_t last, const std::size_t threads,
+                        const Leaf& leaf, const Combine& combine) {
+            const auto wanted = threads == 0? static_cast<std::size_t>(std::thread::hardware_concurrency()): threads;
+            return split<T>(first, last, std::max(wanted, static_cast<std::size_t>(1)), leaf, combine);
+        }
+
+    private:
+        /// @return combination of the values in [first, last) using given number of threads (>= 1)
+        template <typename T, typename Leaf, typename Combine>
+        static T split(const std::size_t first, const std::size_t last, const std::size_t threads,
+                       const Leaf& leaf, const Combine& combine) {
+            if (last - first == 1) {
+                return leaf(first);
+            }
+
+            const auto middle = first + (last - first) / 2;
+            if (threads == 1) {
+                auto lhs = split<T>(first, middle, 1, leaf, combine);
+                return combine(std::move(lhs), split<T>(middle, last, 1, leaf, combine));
+            }
+
+            // the future reports an exception of the other thread
+            auto lhs = std::async(std::launch::async, [first, middle, threads, &leaf, &combine]() {
+                return split<T>(first, middle, threads / 2, leaf, combine);
+            });
+            auto rhs = split<T>(middle, last, threads - threads / 2, leaf, combine);
+            return combine(lhs.get(), std::move(rhs));
+        }
+};
+
+/// @class fraction_sum
+/// @brief exact sum of many fractions.
+///
+/// The fractions are added in a balanced tree (@ref binary_splitting)
+/// with the operators of the fraction.
+template <typename T>
+class fraction_sum final {
+    public:
+        /// no instances
+        fraction_sum() = delete;
+
+        /// @param first random access iterator to the first fraction
+        /// @param last iterator behind the last fraction
+        /// @param threads number of threads to use (0 for one per core)
+        /// @return sum of the fractions (0 for no fractions)
+        /// @throw std::overflow_error when a partial sum does not fit into T
+        template <typename Iterator>
+        static fraction<T> sum(Iterator first, Iterator last, const std::size_t threads) {
+            if (first == last) {
+                return fraction<T>(T(0), T(1));
+            }
+
+            return binary_splitting::reduce<fraction<T>>(
+                0, static_cast<std::size_t>(last - first), threads,
+                [first](const std::size_t index) { return fraction<T>(first[index]); },
+                [](const fraction<T>& lhs, const fraction<T>& rhs) { return lhs + rhs; });
+        }
+};
+
+/// @class fraction_sum<big_integer>
+/// @brief exact sum of many fractions of big integers with delayed reduction.
+///
+/// When all denominators fit into 64 bit they are kept as prime factors with their
+/// exponents: the denominator of a partial sum is the least common multiple of the
+/// denominators (maximum of the exponents) and the numerators are extended by the
+/// missing prime powers - there is no gcd in the tree. The sum is reduced at the end
+/// only: the primes of the denominator dividing the numerator are found with the
+/// remainders of the numerator along a product tree of the primes.
+/// Otherwise the fractions are added (and reduced) in a balanced tree.
+template <>
+class fraction_sum<big_integer> final {
+    public:
+        /// base 10^9 digits (least significant first)
+        using limbs_type = detail::decimal_limbs::limbs_type;
+        /// pairs of prime and exponent (increasing primes)
+        using factors_type = factorization<uint64_t>::factors_type;
+
+        /// no instances
+        fraction_sum() = delete;
+
+        /// @param first random access iterator to the first fraction
+        /// @param last iterator behind the last fraction
+        /// @param threads number of threads to use (0 for one per core)
+        /// @return sum of the fractions (0 for no fractions)
+        template <typename Iterator>
+        static fraction<big_integer> sum(Iterator first, Iterator last, const std::size_t threads) {
+            if (first == last) {
+                return fraction<big_integer>(limbs_type(), limbs_type(1, 1));
+            }
+
+            const auto count = static_cast<std::size_t>(last - first);
+            const auto all_small = std::all_of(first, last, [](const fraction<big_integer>& term) {
+                auto denominator = uint64_t(0);
+                return to_u64(term.m_denominator, denominator);
+            });
+
+            if (!all_small) {
+                return binary_splitting::reduce<fraction<big_integer>>(
+                    0, count, threads,
+                    [first](const std::size_t index) { return fraction<big_integer>(first[index]); },
+                    [](const fraction<big_integer>& lhs, const fraction<big_integer>& rhs) { return lhs + rhs; });
+            }
+
+            auto result = binary_splitting::reduce<term_type>(
+                0, count, threads,
+                [first](const std::size_t index) {
+                    const fraction<big_integer>& term = first[index];
+                    auto denominator = uint64_t(0);
+                    to_u64(term.m_denominator, denominator);
+                    return term_type{term.m_numerator, factorize_u64(denominator)};
+                },
+                [](const term_type& lhs, const term_type& rhs) { return add(lhs, rhs); });
+            return reduce(result);
+        }
+
+    private:
+        /// partial sum with the prime factors of the denominator
+        struct term_type {
+            /// value above the line
+            limbs_type numerator;
+            /// value below the line (prime factors with their exponents)
+            factors_type denominator;
+        };
+
+        /// @param value [in] value to convert
+        /// @param result [out] value as 64 bit integer
+        /// @return true when the value fits into 64 bit
+        static bool to_u64(const limbs_type& value, uint64_t& result) noexcept {
+            if (value.size() > 3) {
+                return false;
+            }
+
+            auto wide = uint128_type(0);
+            for (auto index = value.size(); index > 0; --index) {
+                wide = wide * detail::decimal_limbs::BASE + value[index - 1];
+            }
+            result = static_cast<uint64_t>(wide);
+            return (wide >> 64) == 0;
+        }
+
+        /// @return sum of two partial sums extended to the least common multiple of the denominators
+        static term_type add(const term_type& lhs, const term_type& rhs) {
+            // the missing prime powers of each side
+            factors_type denominator;
+            factors_type lhs_missing;
+            factors_type rhs_missing;
+            auto lhs_factor = lhs.denominator.begin();
+            auto rhs_factor = rhs.denominator.begin();
+            while (lhs_factor != lhs.denominator.end() || rhs_factor != rhs.denominator.end()) {
+                if (rhs_factor == rhs.denominator.end()
+                    || (lhs_factor != lhs.denominator.end() && lhs_factor->first < rhs_factor->first)) {
+                    rhs_missing.push_back(*lhs_factor);
+                    denominator.push_back(*lhs_factor++);
+                } else if (lhs_factor == lhs.denominator.end() || rhs_factor->first < lhs_factor->first) {
+                    lhs_missing.push_back(*rhs_factor);
+                    denominator.push_back(*rhs_factor++);
+                } else {
+                    if (lhs_factor->second < rhs_factor->second) {
+                        lhs_missing.emplace_back(lhs_factor->first, rhs_factor->second - lhs_factor->second);
+                    } else if (rhs_factor->second < lhs_factor->second) {
+                        rhs_missing.emplace_back(lhs_factor->first, lhs_factor->second - rhs_factor->second);
+                    }
+                    denominator.emplace_back(lhs_factor->first, std::max(lhs_factor->second, rhs_factor->second));
+                    ++lhs_factor;
+                    ++rhs_factor;
+                }
+            }
+
+            return term_type{detail::decimal_limbs::add(extend(lhs.numerator, lhs_missing),
+                                                        extend(rhs.numerator, rhs_missing)),
+                             std::move(denominator)};
+        }
+
+        /// @return value multiplied by the prime powers
+        static limbs_type extend(const limbs_type& value, const factors_type& factors) {
+            return factors.empty() || value.empty()
+                ? value: detail::decimal_limbs::multiply(value, binomial::product(factors));
+        }
+
+        /// @return reduced fraction of the sum
+        static fraction<big_integer> reduce(term_type& sum) {
+            if (sum.numerator.empty()) {
+                return fraction<big_integer>(limbs_type(), limbs_type(1, 1));
+            }
+
+            const auto dividing = dividing_primes(sum.numerator, sum.denominator);
+            for (auto index = std::size_t(0); index < dividing.size(); ++index) {
+                if (!dividing[index]) {
+                    continue;
+                }
+
+                auto& factor = sum.denominator[index];
+                const auto prime = detail::decimal_limbs::from_u64(factor.first);
+                for (; factor.second > 0
+                       && detail::decimal_limbs::remainder(sum.numerator, prime).empty(); --factor.second) {
+                    sum.numerator = detail::decimal_limbs::divide(sum.numerator, prime);
+                }
+            }
+
+            return fraction<big_integer>(std::move(sum.numerator), binomial::product(sum.denominator));
+        }
+
+        /// The primes are packed into limbs below BASE (a bigger prime alone); those limbs
+        /// are the leaves of a product tree and the remainders of the value are taken top down.
+        /// @return a flag for each prime factor: true when the prime divides the value
+        static std::vector<bool> dividing_primes(const limbs_type& value, const factors_type& factors) {
+            if (factors.empty()) {
+                return std::vector<bool>();
+            }
+
+            std::vector<uint64_t> products;
+            std::vector<std::size_t> starts;
+            for (auto index = std::size_t(0); index < factors.size(); ++index) {
+                const auto prime = factors[index].first;
+                if (products.empty() || products.back() >= detail::decimal_limbs::BASE / prime) {
+                    products.push_back(prime);
+                    starts.push_back(index);
+                } else {
+                    products.back() *= prime;
+                }
+            }
+            starts.push_back(factors.size());
+
+            std::vector<std::vector<limbs_type>> levels(1);
+            for (const auto product: products) {
+                levels.front().push_back(detail::decimal_limbs::from_u64(product));
+            }
+            while (levels.back().size() > 1) {
+                const auto& below = levels.back();
+                std::vector<limbs_type> above;
+                for (auto index = std::size_t(1); index < below.size(); index += 2) {
+                    above.push_back(detail::decimal_limbs::multiply(below[index - 1], below[index]));
+                }
+                if (below.size() % 2 == 1) {
+                    above.push_back(below.back());
+                }
+                levels.push_back(std::move(above));
+            }
+
+            std::vector<limbs_type> rests(1, detail::decimal_limbs::remainder(value, levels.back().front()));
+            for (auto level = levels.size() - 1; level > 0; --level) {
+                const auto& below = levels[level - 1];
+                std::vector<limbs_type> next;
+                for (auto index = std::size_t(0); index < below.size(); ++index) {
+                    next.push_back(detail::decimal_limbs::remainder(rests[index / 2], below[index]));
+                }
+                rests.swap(next);
+            }
+
+            std::vector<bool> dividing(factors.size(), false);
+            for (auto leaf = std::size_t(0); leaf < products.size(); ++leaf) {
+                auto rest = uint64_t(0);
+                to_u64(rests[leaf], rest);
+                for (auto index = starts[leaf]; index < starts[leaf + 1]; ++index) {
+                    dividing[index] = rest % factors[index].first == 0;
+                }
+            }
+            return dividing;
+        }
+};
+
+/// Adding many fractions exactly like the harmonic number
+/// \f$H_n = \sum_{k=1}^{n} \frac{1}{k}\f$.
+///
+/// @code
+/// std::vector<math::fraction<math::big_integer>> terms;
+/// for (auto k = 1; k <= 1000000; ++k) {
+///     terms.emplace_back(math::big_integer(1), math::big_integer(k));
+/// }
+/// const auto h = math::sum_fractions(terms.begin(), terms.end(), 0);
+/// @endcode
+///
+/// @param first random access iterator to the first fraction
+/// @param last iterator behind the last fraction
+/// @param threads number of threads to use (0 for one per core)
+/// @return sum of the fractions (reduced; 0 for no fractions)
+template <typename Iterator>
+fraction<typename std::iterator_traits<Iterator>::value_type::value_type>
+sum_fractions(Iterator first, Iterator last, const std::size_t threads = 1) {
+    return fraction_sum<typename std::iterator_traits<Iterator>::value_type::value_type>::sum(first, last, threads);
+}
+
+/// @param terms random access range of fractions (like a vector)
+/// @param threads number of threads to use (0 for one per core)
+/// @return sum of the fractions (reduced; 0 for no fractions)
+template <typename Range>
+auto sum_fractions(const Range& terms, const std::size_t threads = 1)
+    -> decltype(sum_fractions(std::begin(terms), std::end(terms), threads)) {
+    return sum_fractions(std::begin(terms), std::end(terms), threads);
+}
+
+}  // namespace math
+
+#endif  // INCLUDE_MATH_SUM_FRACTIONS_H_
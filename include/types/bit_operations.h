@@ -0,0 +1,118 @@
+///
+/// @author  Thomas Lehmann
+/// @file    bit_operations.h
+/// @brief   bit level helpers (counting and scanning bits)
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_TYPES_BIT_OPERATIONS_H_
+#define INCLUDE_TYPES_BIT_OPERATIONS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace types {
+
+/// @param value word to be scanned (may not be 0)
+/// @return index of lowest set bit (number of zeros before first set bit)
+/// @note uses the processor instruction when compiled with gcc or clang (usable at compile time).
+constexpr uint32_t count_trailing_zeros(const uint64_t value) noexcept {
+#if defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#else
+    return (value & 1) != 0? 0: 1 + count_trailing_zeros(value >> 1);
+#endif
+}
+
+/// @param value word to be counted
+/// @return number of set bits
+/// @note uses the processor instruction when compiled with gcc or clang.
+inline uint32_t population_count(const uint64_t value) noexcept {
+#if defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_popcountll(value));
+#else
+    auto result = static_cast<uint32_t>(0);
+    for (auto bits = value; bits != 0; bits &= bits - 1) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+/// Scanning whole words for the next set bit (skipping empty words at once).
+/// @param words the words with the bits (bit n is bit n%64 of word n/64)
+/// @param number_of_bits number of valid bits
+/// @param nth first bit to check
+/// @return index of first set bit >= nth or number_of_bits when there is none
+inline uint64_t find_next_bit(const uint64_t* words, const uint64_t number_of_bits, const uint64_t nth) noexcept {
+    if (nth >= number_of_bits) {
+        return number_of_bits;
+    }
+
+    auto index = nth / 64;
+    auto word = words[index] & (~static_cast<uint64_t>(0) << (nth % 64));
+    const auto last_index = (number_of_bits + 63) / 64;
+
+    while (word == 0) {
+        if (++index >= last_index) {
+            return number_of_bits;
+        }
+        word = words[index];
+    }
+
+    const auto found = index * 64 + count_trailing_zeros(word);
+    return (found < number_of_bits)? found: number_of_bits;
+}
+
+/// Reading many bits at once without any branch; with AVX2 four bits
+/// are gathered with one instruction.
+/// @param words the words with the bits (bit n is bit n%64 of word n/64)
+/// @param indices indices of the bits to read (have to be valid)
+/// @param count number of indices
+/// @param results [out] 0 or 1 for each index
+inline void gather_bits(const uint64_t* words, const uint64_t* indices,
+                        const std::size_t count, uint8_t* results) noexcept {
+    auto position = static_cast<std::size_t>(0);
+#if defined(__AVX2__)
+    const auto bit_mask = _mm256_set1_epi64x(63);
+    const auto one = _mm256_set1_epi64x(1);
+    for (; position + 4 <= count; position += 4) {
+        const auto bit_indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + position));
+        const auto gathered = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(words),
+                                                     _mm256_srli_epi64(bit_indices, 6), 8);
+        const auto bits = _mm256_and_si256(_mm256_srlv_epi64(gathered, _mm256_and_si256(bit_indices, bit_mask)), one);
+        alignas(32) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), bits);
+        for (auto lane = 0; lane < 4; ++lane) {
+            results[position + lane] = static_cast<uint8_t>(lanes[lane]);
+        }
+    }
+#endif
+    for (; position < count; ++position) {
+        const auto index = indices[position];
+        results[position] = static_cast<uint8_t>((words[index / 64] >> (index % 64)) & 1);
+    }
+}
+
+}  // namespace types
+
+#endif  // INCLUDE_TYPES_BIT_OPERATIONS_H_
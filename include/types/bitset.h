@@ -23,13 +23,17 @@
 #ifndef INCLUDE_TYPES_BITSET_H_
 #define INCLUDE_TYPES_BITSET_H_
 
+#include <types/bit_operations.h>
+
 #include <stdexcept>
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 #include <limits>
 #include <string>
 #include <sstream>
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -55,11 +59,36 @@ class bitset final {
                 throw std::runtime_error("You cannot have a bitset with no bits");
             }
 
-            m_buckets.reset(new value_type[size()]);
+            m_buckets.reset(new value_type[buckets() + 1]);
             const value_type all_set = std::numeric_limits<value_type>::max();
             std::fill(m_buckets.get(), m_buckets.get() + buckets() + 1, flag? all_set: 0);
         }
 
+        /// Changing number of bits keeping the existing ones.
+        /// @param number_of_bits new number of bits
+        /// @param flag state for the new bits (when growing)
+        void resize(const size_type number_of_bits, const bool flag = false) {
+            if (number_of_bits == 0) {
+                throw std::runtime_error("You cannot have a bitset with no bits");
+            }
+
+            const auto old_number_of_bits = m_number_of_bits;
+            const auto old_buckets = buckets();
+            m_number_of_bits = number_of_bits;
+
+            std::unique_ptr<value_type[]> new_buckets(new value_type[buckets() + 1]);
+            const value_type all_set = std::numeric_limits<value_type>::max();
+            std::fill(new_buckets.get(), new_buckets.get() + buckets() + 1, flag? all_set: 0);
+            std::copy(m_buckets.get(), m_buckets.get() + std::min(old_buckets, buckets() + 1), new_buckets.get());
+            m_buckets.swap(new_buckets);
+
+            // the bits behind the old size in the last copied bucket have an undefined state
+            const auto limit = std::min(number_of_bits, (old_number_of_bits / BITS_PER_BUCKET + 1) * BITS_PER_BUCKET);
+            for (auto nth = old_number_of_bits; nth < limit; ++nth) {
+                (*this)[nth] = flag;
+            }
+        }
+
         /// @class proxy
         class bit final {
             public:
@@ -102,6 +131,16 @@ class bitset final {
             return bit(&m_buckets[nth/BITS_PER_BUCKET], nth % BITS_PER_BUCKET);
         }
 
+        /// @return the buckets (for word wise operations)
+        inline value_type* data() noexcept {
+            return m_buckets.get();
+        }
+
+        /// @return the buckets (for word wise operations)
+        inline const value_type* data() const noexcept {
+            return m_buckets.get();
+        }
+
         /// @return number of buckets
         inline size_type buckets() const noexcept {
             return m_number_of_bits / BITS_PER_BUCKET
@@ -113,6 +152,47 @@ class bitset final {
             return m_number_of_bits;
         }
 
+        /// Scanning whole buckets for the next set bit (skipping empty buckets at once).
+        /// @param nth first bit to check
+        /// @return index of first set bit >= nth or size() when there is none
+        size_type find_next(const size_type nth) const noexcept {
+            if (nth >= m_number_of_bits) {
+                return m_number_of_bits;
+            }
+
+            auto index = nth / BITS_PER_BUCKET;
+            // ignoring the bits before nth in the first bucket
+            auto bucket = static_cast<uint64_t>(m_buckets[index])
+                        & (~static_cast<uint64_t>(0) << (nth % BITS_PER_BUCKET));
+            const auto last_index = buckets();
+
+            while (bucket == 0) {
+                if (++index >= last_index) {
+                    return m_number_of_bits;
+                }
+                bucket = static_cast<uint64_t>(m_buckets[index]);
+            }
+
+            return std::min(index * BITS_PER_BUCKET + count_trailing_zeros(bucket), m_number_of_bits);
+        }
+
+        /// Reading many bits at once without any branch (see @ref types::gather_bits).
+        /// @param indices indices of the bits to read (have to be < size())
+        /// @param count number of indices
+        /// @param results [out] 0 or 1 for each index
+        void gather(const size_type* indices, const std::size_t count, uint8_t* results) const noexcept {
+            if (BITS_PER_BUCKET == 64) {
+                gather_bits(reinterpret_cast<const uint64_t*>(m_buckets.get()), indices, count, results);
+                return;
+            }
+
+            for (auto position = static_cast<std::size_t>(0); position < count; ++position) {
+                const auto index = indices[position];
+                const auto bucket = m_buckets[index / BITS_PER_BUCKET];
+                results[position] = static_cast<uint8_t>((bucket >> (index % BITS_PER_BUCKET)) & 1);
+            }
+        }
+
         /// @return bitset as string with "0"'s and "1"'s
         std::string to_string() const noexcept {
             std::stringstream stream;
@@ -135,6 +215,42 @@ class bitset final {
         std::unique_ptr<value_type[]> m_buckets;
 };
 
+/// @param container any container providing bool states like std::vector<bool>
+/// @param nth first position to check
+/// @return index of first true state >= nth or size() when there is none
+template <typename C>
+inline uint64_t find_next(const C& container, const uint64_t nth) {
+    if (nth >= container.size()) {
+        return container.size();
+    }
+    return std::find(container.begin() + nth, container.end(), true) - container.begin();
+}
+
+/// @copydoc @ref types::bitset::find_next
+template <typename T>
+inline uint64_t find_next(const bitset<T>& container, const uint64_t nth) noexcept {
+    return container.find_next(nth);
+}
+
+/// Reading many states of a container at once.
+/// @param container any container providing bool states like std::vector<bool>
+/// @param indices indices of the states to read (have to be < size())
+/// @param count number of indices
+/// @param results [out] 0 or 1 for each index
+template <typename C>
+inline void gather(const C& container, const uint64_t* indices, const std::size_t count, uint8_t* results) {
+    for (auto position = static_cast<std::size_t>(0); position < count; ++position) {
+        results[position] = static_cast<uint8_t>(container[indices[position]]);
+    }
+}
+
+/// @copydoc @ref types::bitset::gather
+template <typename T>
+inline void gather(const bitset<T>& container, const uint64_t* indices,
+                   const std::size_t count, uint8_t* results) noexcept {
+    container.gather(indices, count, results);
+}
+
 }  // namespace types
 
 #endif  // INCLUDE_TYPES_BITSET_H_
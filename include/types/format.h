@@ -0,0 +1,233 @@
+///
+/// @author  Thomas Lehmann
+/// @file    format.h
+/// @brief   allocation-free integer to decimal formatting and a buffered output sink
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef INCLUDE_TYPES_FORMAT_H_
+#define INCLUDE_TYPES_FORMAT_H_
+
+#include <type_traits>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+namespace types {
+
+/// maximum number of characters written by @ref to_chars (sign and 20 digits)
+enum {MAX_DECIMAL_CHARS = 21};
+
+/// @return table with the two characters for each of 00..99
+inline const char* decimal_pairs() noexcept {
+    static const char pairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    return pairs;
+}
+
+/// @param value the value to be counted
+/// @return number of decimal digits of given value (1 for 0)
+inline uint32_t count_decimal_digits(const uint64_t value) noexcept {
+    auto result = static_cast<uint32_t>(1);
+    auto rest = value;
+    for (; rest >= 10000; rest /= 10000) {
+        result += 4;
+    }
+    return result + (rest >= 10? 1: 0) + (rest >= 100? 1: 0) + (rest >= 1000? 1: 0);
+}
+
+/// Writing exactly given number of decimal digits (the lowest ones, filled up with
+/// leading zeros) two digits per step from the right.
+/// @param buffer where to write the digits to (no terminating zero)
+/// @param value the value to be written
+/// @param width the number of digits to write
+/// @return pointer behind the last written character
+inline char* to_chars_zero_padded(char* buffer, const uint64_t value, const uint32_t width) noexcept {
+    const auto pairs = decimal_pairs();
+    auto rest = value;
+    auto position = buffer + width;
+    for (; position - buffer >= 2; rest /= 100) {
+        position -= 2;
+        std::memcpy(position, pairs + 2 * (rest % 100), 2);
+    }
+    if (position != buffer) {
+        *buffer = static_cast<char>('0' + rest % 10);
+    }
+    return buffer + width;
+}
+
+/// Writing the decimal digits of given unsigned value (like std::to_chars of C++17).
+/// @param buffer where to write the digits to (at least 20 characters, no terminating zero)
+/// @param value the value to be written
+/// @return pointer behind the last written character
+inline char* to_chars(char* buffer, const uint64_t value, std::false_type) noexcept {
+    return to_chars_zero_padded(buffer, value, count_decimal_digits(value));
+}
+
+/// Writing the decimal digits of given signed value (with leading '-' when negative).
+/// @param buffer where to write the characters to (at least 21 characters, no terminating zero)
+/// @param value the value to be written
+/// @return pointer behind the last written character
+inline char* to_chars(char* buffer, const int64_t value, std::true_type) noexcept {
+    if (value >= 0) {
+        return to_chars(buffer, static_cast<uint64_t>(value), std::false_type());
+    }
+    *buffer = '-';
+    return to_chars(buffer + 1, uint64_t(0) - static_cast<uint64_t>(value), std::false_type());
+}
+
+/// Writing the decimal characters of given integral value.
+///
+/// @code
+/// char buffer[types::MAX_DECIMAL_CHARS];
+/// std::string(buffer, types::to_chars(buffer, -1234));  // "-1234"
+/// @endcode
+///
+/// @param buffer where to write the characters to (at least MAX_DECIMAL_CHARS, no terminating zero)
+/// @param value the value to be written
+/// @return pointer behind the last written character
+template <typename T>
+inline char* to_chars(char* buffer, const T value) noexcept {
+    static_assert(std::is_integral<T>::value, "to_chars requires an integral type");
+    return to_chars(buffer, static_cast<typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type>(
+        value), std::is_signed<T>());
+}
+
+/// @class output_sink
+/// @brief collecting formatted output in a buffer writing it to the stream in big blocks.
+///
+/// @code
+/// types::output_sink sink(std::cout);
+/// for (const auto prime: primes) {
+///     sink.write(prime, 10).write('\n');
+/// }
+/// @endcode
+///
+/// The buffer is written when full, on @ref flush and on destruction.
+class output_sink final {
+    public:
+        /// size of the buffer
+        enum {CAPACITY = 65536};
+
+        /// initializing the sink for given stream
+        explicit output_sink(std::ostream& stream)
+            : m_stream(stream), m_buffer(CAPACITY), m_size(0) {}
+
+        /// writing the rest of the buffer
+        ~output_sink() {
+            flush();
+        }
+
+        /// a sink is not copied
+        output_sink(const output_sink&) = delete;
+        /// a sink is not assigned
+        output_sink& operator = (const output_sink&) = delete;
+
+        /// @return sink to continue write operations
+        output_sink& write(const char character) {
+            reserve(1);
+            m_buffer[m_size++] = character;
+            return *this;
+        }
+
+        /// @return sink to continue write operations
+        output_sink& write(const std::string& text) {
+            return append(text.data(), text.size());
+        }
+
+        /// @return sink to continue write operations
+        output_sink& write(const char* text) {
+            return append(text, std::strlen(text));
+        }
+
+        /// writing decimal characters of given integral value
+        /// @return sink to continue write operations
+        template <typename T>
+        output_sink& write(const T value) {
+            reserve(MAX_DECIMAL_CHARS);
+            m_size = static_cast<std::size_t>(to_chars(m_buffer.data() + m_size, value) - m_buffer.data());
+            return *this;
+        }
+
+        /// writing decimal characters of given integral value right aligned (like std::setw)
+        /// @return sink to continue write operations
+        template <typename T>
+        output_sink& write(const T value, const std::size_t width) {
+            char digits[MAX_DECIMAL_CHARS];
+            const auto length = static_cast<std::size_t>(to_chars(digits, value) - digits);
+            for (auto padding = length; padding < width; ++padding) {
+                write(' ');
+            }
+            reserve(length);
+            std::memcpy(m_buffer.data() + m_size, digits, length);
+            m_size += length;
+            return *this;
+        }
+
+        /// writing exactly given number (at most 20) of the lowest decimal digits (filled up with zeros)
+        /// @return sink to continue write operations
+        output_sink& write_zero_padded(const uint64_t value, const uint32_t width) {
+            reserve(width);
+            to_chars_zero_padded(m_buffer.data() + m_size, value, width);
+            m_size += width;
+            return *this;
+        }
+
+        /// writing the buffer to the stream
+        void flush() {
+            m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_size));
+            m_size = 0;
+        }
+
+    private:
+        /// copying given characters into the buffer (in blocks of at most CAPACITY characters)
+        /// @return sink to continue write operations
+        output_sink& append(const char* text, const std::size_t size) {
+            for (auto offset = std::size_t(0); offset < size; offset += CAPACITY) {
+                const auto length = std::min(size - offset, static_cast<std::size_t>(CAPACITY));
+                reserve(length);
+                std::memcpy(m_buffer.data() + m_size, text + offset, length);
+                m_size += length;
+            }
+            return *this;
+        }
+
+        /// flushing the buffer when there is less free space than given length (at most CAPACITY)
+        void reserve(const std::size_t length) {
+            if (m_size + length > m_buffer.size()) {
+                flush();
+            }
+        }
+
+        /// stream where to write the buffer to
+        std::ostream& m_stream;
+        /// the buffer
+        std::vector<char> m_buffer;
+        /// number of used characters of the buffer
+        std::size_t m_size;
+};
+
+}  // namespace types
+
+#endif  // INCLUDE_TYPES_FORMAT_H_
@@ -23,6 +23,9 @@
 #ifndef INCLUDE_TYPES_TO_STREAM_H_
 #define INCLUDE_TYPES_TO_STREAM_H_
 
+#include <types/format.h>
+
+#include <type_traits>
 #include <vector>
 #include <list>
 #include <set>
@@ -30,11 +33,37 @@
 
 namespace types {
 
+/// @brief true for the integral types printed as numbers (not bool and not the character types)
+template <typename T>
+struct is_number_type final : std::integral_constant<bool, std::is_integral<T>::value
+    && !std::is_same<T, bool>::value && !std::is_same<T, char>::value && !std::is_same<T, signed char>::value
+    && !std::is_same<T, wchar_t>::value && !std::is_same<T, char16_t>::value
+    && !std::is_same<T, char32_t>::value> {};
+
 /// @class to_stream<T>
-/// @brief general dumper for usual data types
+/// @brief general dumper for usual data types (integers in plain decimal format are formatted directly)
 template <class T>
 struct to_stream final {
     static void dump(std::ostream& stream, const T& value) {
+        dump(stream, value, is_number_type<T>());
+    }
+
+    /// writing the decimal characters of an integer (the stream operator
+    /// when the stream is not decimal, has a width or shows a plus sign)
+    static void dump(std::ostream& stream, const T& value, std::true_type) {
+        const auto base = stream.flags() & std::ios_base::basefield;
+        if ((base != std::ios_base::dec && base != 0) || (stream.flags() & std::ios_base::showpos)
+            || stream.width() != 0) {
+            stream << value;
+            return;
+        }
+
+        char buffer[MAX_DECIMAL_CHARS];
+        stream.write(buffer, to_chars(buffer, value) - buffer);
+    }
+
+    /// using the stream operator of the type
+    static void dump(std::ostream& stream, const T& value, std::false_type) {
         stream << value;
     }
 };
@@ -53,7 +82,7 @@ struct to_stream<bool> final {
 template <>
 struct to_stream<unsigned char> final {
     static void dump(std::ostream& stream, const unsigned char& value) {
-        stream << static_cast<uint32_t>(value);
+        to_stream<uint32_t>::dump(stream, value);
     }
 };
 
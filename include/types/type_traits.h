@@ -30,6 +30,7 @@
 #include <stack>
 #include <set>
 #include <unordered_set>
+#include <cstddef>
 
 namespace types {
 
@@ -73,6 +74,39 @@ struct is_container<std::unordered_set<T>> final {
     static constexpr bool value = true;
 };
 
+/// @struct index_sequence
+/// @brief compile time sequence of indices (std::index_sequence is C++14).
+template <std::size_t... I>
+struct index_sequence {
+    /// the sequence itself
+    using type = index_sequence;
+    /// @return number of indices
+    static constexpr std::size_t size() noexcept {
+        return sizeof...(I);
+    }
+};
+
+/// appending second sequence (shifted by the size of the first one) to the first one
+template <typename L, typename R>
+struct concat_index_sequence;
+
+template <std::size_t... L, std::size_t... R>
+struct concat_index_sequence<index_sequence<L...>, index_sequence<R...>>
+    : index_sequence<L..., (sizeof...(L) + R)...> {};
+
+/// @struct make_index_sequence
+/// @brief index_sequence<0, 1, ..., N-1> (logarithmic instantiation depth)
+template <std::size_t N>
+struct make_index_sequence
+    : concat_index_sequence<typename make_index_sequence<N / 2>::type,
+                            typename make_index_sequence<N - N / 2>::type>::type {};
+
+template <>
+struct make_index_sequence<0> : index_sequence<> {};
+
+template <>
+struct make_index_sequence<1> : index_sequence<0> {};
+
 }  // namespace types
 
 #endif  // INCLUDE_TYPES_TYPE_TRAITS_H_
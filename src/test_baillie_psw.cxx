@@ -0,0 +1,128 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_baillie_psw.cxx
+/// @brief   testing of @ref math::prime::baillie_psw
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/baillie_psw.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <math/big_integer.h>
+#include <types/bitset.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+using math::prime::baillie_psw;
+
+/// @return big integer for given decimal digits
+static math::big_integer to_big_integer(const std::string& text) {
+    math::digits_type digits;
+    for (auto it = text.rbegin(); it != text.rend(); ++it) {
+        digits.push_back(static_cast<math::digit_type>(*it - '0'));
+    }
+    return math::big_integer(digits);
+}
+
+/// testing of class @ref math::prime::baillie_psw
+describe_suite("testing math::prime::baillie_psw", [](){
+    describe_test("testing conversion to limbs", []() {
+        assert_that(baillie_psw::limbs_type(), is_equal(baillie_psw::to_limbs(math::big_integer(0))));
+        assert_that(baillie_psw::limbs_type({12345}), is_equal(baillie_psw::to_limbs(math::big_integer(12345))));
+        assert_that(baillie_psw::limbs_type({0, 1}),
+                    is_equal(baillie_psw::to_limbs(to_big_integer("18446744073709551616"))));
+        // 2^127 - 1
+        assert_that(baillie_psw::limbs_type({0xffffffffffffffff, 0x7fffffffffffffff}),
+                    is_equal(baillie_psw::to_limbs(to_big_integer("170141183460469231731687303715884105727"))));
+    });
+
+    describe_test("testing numbers with one limb", []() {
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(17000000);
+        sieve.calculate();
+
+        // below and above the limit of trial division only (4096^2)
+        for (const auto first: {uint64_t(0), uint64_t(16757216)}) {
+            for (auto number = first; number < first + 40000; ++number) {
+                assert_that(sieve.is_prime(number),
+                            is_equal(baillie_psw::is_probable_prime(baillie_psw::limbs_type({number}))));
+            }
+        }
+    });
+
+    describe_test("testing strong pseudoprimes to base 2", []() {
+        // p * (2p - 1) with both factors above the trial division limit
+        for (const auto number: {uint64_t(36307981), uint64_t(48191653), uint64_t(66096253),
+                                 uint64_t(74927161), uint64_t(68512867)}) {
+            assert_that(false, is_equal(baillie_psw::is_probable_prime(baillie_psw::limbs_type({number}))));
+        }
+        // 18446744073709555501 * 36893488147419111001
+        assert_that(false, is_equal(baillie_psw::is_probable_prime(
+            to_big_integer("680564733841877213570705376236289166501"))));
+        // squares of primes
+        assert_that(false, is_equal(baillie_psw::is_probable_prime(math::big_integer(uint64_t(4099) * 4099))));
+        assert_that(false, is_equal(baillie_psw::is_probable_prime(
+            to_big_integer("340282366920938461286658806734041124249"))));
+    });
+
+    describe_test("testing big numbers", []() {
+        // 2^127 - 1 and the next number
+        assert_that(true, is_equal(baillie_psw::is_probable_prime(
+            to_big_integer("170141183460469231731687303715884105727"))));
+        assert_that(false, is_equal(baillie_psw::is_probable_prime(
+            to_big_integer("170141183460469231731687303715884105729"))));
+        // first prime above 2^511
+        const auto prime = to_big_integer(
+            "6703903964971298549787012499102923063739682910296196688861780721860882015036773488400937149083451713845"
+            "015929093243025426876941405973284973216824503042159");
+        assert_that(true, is_equal(baillie_psw::is_probable_prime(prime)));
+        // 2^521 - 1 is prime, 2^523 - 1 is not
+        baillie_psw::limbs_type mersenne(9, ~uint64_t(0));
+        mersenne[8] = (uint64_t(1) << 9) - 1;
+        assert_that(true, is_equal(baillie_psw::is_probable_prime(mersenne)));
+        mersenne[8] = (uint64_t(1) << 11) - 1;
+        assert_that(false, is_equal(baillie_psw::is_probable_prime(mersenne)));
+    });
+
+    describe_test("testing batch", []() {
+        std::vector<math::big_integer> numbers;
+        for (auto number = 1000000000000000000ULL; number < 1000000000000000000ULL + 1000; ++number) {
+            numbers.push_back(math::big_integer(number));
+        }
+
+        std::vector<uint8_t> expected;
+        for (const auto& number: numbers) {
+            expected.push_back(baillie_psw::is_probable_prime(number)? 1: 0);
+        }
+
+        for (const auto threads: {std::size_t(0), std::size_t(1), std::size_t(3)}) {
+            std::vector<uint8_t> results(numbers.size(), 2);
+            baillie_psw::is_probable_prime_batch(numbers.data(), numbers.size(), results.data(), threads);
+            assert_that(expected, is_equal(results));
+        }
+
+        // 1000000000000000003 is the first prime above 10^18
+        assert_that(uint8_t(1), is_equal(expected[3]));
+        assert_that(std::size_t(23), is_equal(std::size_t(std::count(expected.begin(), expected.end(), 1))));
+    });
+});
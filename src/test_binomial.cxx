@@ -0,0 +1,102 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_binomial.cxx
+/// @brief   testing of @ref math::binomial
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/binomial.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+/// testing of class @ref math::binomial
+describe_suite("testing math::binomial", [](){
+    /// testing @ref math::binomial::factorial_exponent
+    describe_test("testing factorial_exponent", []() {
+        // 10! = 2^8 * 3^4 * 5^2 * 7
+        assert_that(uint64_t(8), is_equal(math::binomial::factorial_exponent(10, 2)));
+        assert_that(uint64_t(4), is_equal(math::binomial::factorial_exponent(10, 3)));
+        assert_that(uint64_t(2), is_equal(math::binomial::factorial_exponent(10, 5)));
+        assert_that(uint64_t(0), is_equal(math::binomial::factorial_exponent(10, 11)));
+        assert_that(uint64_t(249998), is_equal(math::binomial::factorial_exponent(1000000, 5)));
+    });
+
+    /// testing @ref math::binomial::factors
+    describe_test("testing factors", []() {
+        // 120 = 2^3 * 3 * 5
+        const auto expected = math::binomial::factors_type({{2, 3}, {3, 1}, {5, 1}});
+        assert_that(true, is_equal(expected == math::binomial::factors(10, 3)));
+        assert_that(true, is_equal(math::binomial::factors(10, 0).empty()));
+        assert_raise<std::runtime_error>("binomial coefficient is 0 for k > n", []() {
+            math::binomial::factors(3, 4);
+        });
+    });
+
+    /// testing @ref math::binomial::coefficient
+    describe_test("testing coefficient", []() {
+        assert_that(std::string("1"), is_equal(math::binomial::coefficient(0, 0).to_string()));
+        assert_that(std::string("1"), is_equal(math::binomial::coefficient(7, 7).to_string()));
+        assert_that(std::string("120"), is_equal(math::binomial::coefficient(10, 3).to_string()));
+        assert_that(std::string("126410606437752"), is_equal(math::binomial::coefficient(50, 25).to_string()));
+        assert_that(std::string("100891344545564193334812497256"),
+                    is_equal(math::binomial::coefficient(100, 50).to_string()));
+        assert_that(std::string("1333313333400000"), is_equal(math::binomial::coefficient(200000, 3).to_string()));
+        assert_that(true, is_equal(math::binomial::coefficient(3, 4).to_string().empty()));
+
+        // Pascal's triangle
+        auto mismatches = 0;
+        std::vector<uint64_t> row = {1};
+        for (auto n = uint64_t(1); n <= 60; ++n) {
+            std::vector<uint64_t> next(n + 1, 1);
+            for (auto k = uint64_t(1); k < n; ++k) {
+                next[k] = row[k - 1] + row[k];
+            }
+            row.swap(next);
+            for (auto k = uint64_t(0); k <= n; ++k) {
+                if (std::to_string(row[k]) != math::binomial::coefficient(n, k).to_string()) {
+                    ++mismatches;
+                }
+            }
+        }
+        assert_that(0, is_equal(mismatches));
+    });
+
+    /// testing @ref math::binomial::coefficient for big values
+    describe_test("testing coefficient with 30101 digits", []() {
+        const auto value = math::binomial::coefficient(100000, 50000).to_string();
+        assert_that(std::size_t(30101), is_equal(value.size()));
+        assert_that(std::string("252060836892200338850090011673"), is_equal(value.substr(0, 30)));
+        assert_that(std::string("640886651313872846009891416640"), is_equal(value.substr(value.size() - 30)));
+    });
+
+    /// testing @ref math::binomial::multinomial
+    describe_test("testing multinomial", []() {
+        assert_that(std::string("1260"), is_equal(math::binomial::multinomial({2, 3, 4}).to_string()));
+        assert_that(std::string("5550996791340"), is_equal(math::binomial::multinomial({10, 10, 10}).to_string()));
+        assert_that(std::string("1"), is_equal(math::binomial::multinomial({}).to_string()));
+        assert_raise<std::overflow_error>("sum of the multinomial parts does not fit into 64 bit", []() {
+            math::binomial::multinomial_factors({UINT64_MAX, 1});
+        });
+    });
+});
@@ -0,0 +1,54 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_bit_operations.cxx
+/// @brief   testing of bit operations in namespace @ref types
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <types/bit_operations.h>
+#include <vector>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+/// testing of functions in @ref types/bit_operations.h
+describe_suite("testing types bit operations", [](){
+    describe_test("testing count_trailing_zeros", []() {
+        assert_that(uint32_t(0), is_equal(types::count_trailing_zeros(1)));
+        assert_that(uint32_t(3), is_equal(types::count_trailing_zeros(8)));
+        assert_that(uint32_t(4), is_equal(types::count_trailing_zeros(0xf0)));
+        assert_that(uint32_t(63), is_equal(types::count_trailing_zeros(uint64_t(1) << 63)));
+    });
+
+    describe_test("testing population_count", []() {
+        assert_that(uint32_t(0), is_equal(types::population_count(0)));
+        assert_that(uint32_t(1), is_equal(types::population_count(8)));
+        assert_that(uint32_t(8), is_equal(types::population_count(0xff00)));
+        assert_that(uint32_t(64), is_equal(types::population_count(~uint64_t(0))));
+    });
+
+    describe_test("testing gather_bits", []() {
+        const std::vector<uint64_t> words = {0x5, uint64_t(1) << 63, 0x0, 0x1};
+        const std::vector<uint64_t> indices = {0, 1, 2, 127, 126, 128, 192, 193, 0};
+        std::vector<uint8_t> results(indices.size(), 2);
+        types::gather_bits(words.data(), indices.data(), indices.size(), results.data());
+        assert_that(std::vector<uint8_t>({1, 0, 1, 1, 0, 0, 1, 0, 1}), is_equal(results));
+    });
+});
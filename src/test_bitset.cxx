@@ -22,6 +22,7 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <unittest/unittest.h>
 #include <types/bitset.h>
+#include <vector>
 #include <cstdint>
 
 using namespace unittest;
@@ -149,4 +150,66 @@ describe_suite("testing types::bitset", [](){
         assert_that(std::string("0111111111111111111111111111111001111111111111111111111111111110"),
                     is_equal(bs.to_string()));
     });
+
+    describe_test("testing find_next (several buckets)", []() {
+        types::bitset<uint64_t> bs(200);
+        bs[3] = true;
+        bs[64] = true;
+        bs[199] = true;
+
+        assert_that(types::bitset<uint64_t>::size_type(3), is_equal(bs.find_next(0)));
+        assert_that(types::bitset<uint64_t>::size_type(3), is_equal(bs.find_next(3)));
+        assert_that(types::bitset<uint64_t>::size_type(64), is_equal(bs.find_next(4)));
+        assert_that(types::bitset<uint64_t>::size_type(199), is_equal(bs.find_next(65)));
+        assert_that(types::bitset<uint64_t>::size_type(200), is_equal(bs.find_next(200)));
+    });
+
+    describe_test("testing find_next (bits behind size are ignored)", []() {
+        const types::bitset<unsigned char> bs(10, true);
+        assert_that(types::bitset<unsigned char>::size_type(9), is_equal(bs.find_next(9)));
+        assert_that(types::bitset<unsigned char>::size_type(10), is_equal(bs.find_next(10)));
+        assert_that(uint64_t(10), is_equal(types::find_next(bs, 11)));
+    });
+
+    describe_test("testing find_next for std::vector<bool>", []() {
+        std::vector<bool> flags(100, false);
+        flags[42] = true;
+        assert_that(uint64_t(42), is_equal(types::find_next(flags, 0)));
+        assert_that(uint64_t(100), is_equal(types::find_next(flags, 43)));
+        assert_that(uint64_t(100), is_equal(types::find_next(flags, 1000)));
+    });
+
+    describe_test("testing resize (keeping existing bits)", []() {
+        types::bitset<unsigned char> bs(10, true);
+        bs[3] = false;
+
+        bs.resize(30, false);
+        assert_that(types::bitset<unsigned char>::size_type(30), is_equal(bs.size()));
+        assert_that(types::bitset<unsigned char>::size_type(4), is_equal(bs.find_next(3)));
+        assert_that(types::bitset<unsigned char>::size_type(30), is_equal(bs.find_next(10)));
+
+        bs.resize(40, true);
+        assert_that(types::bitset<unsigned char>::size_type(30), is_equal(bs.find_next(10)));
+        assert_that(false, is_equal(static_cast<bool>(bs[3])));
+
+        bs.resize(5);
+        assert_that(types::bitset<unsigned char>::size_type(4), is_equal(bs.find_next(3)));
+        assert_that(types::bitset<unsigned char>::size_type(5), is_equal(bs.find_next(5)));
+    });
+
+    describe_test("testing gather", []() {
+        types::bitset<uint64_t> bs_a(130);
+        types::bitset<unsigned char> bs_b(130);
+        for (const auto index: {3, 64, 129}) {
+            bs_a[index] = true;
+            bs_b[index] = true;
+        }
+        const std::vector<uint64_t> indices = {0, 3, 64, 65, 129, 3};
+        std::vector<uint8_t> results_a(indices.size(), 2);
+        std::vector<uint8_t> results_b(indices.size(), 2);
+        types::gather(bs_a, indices.data(), indices.size(), results_a.data());
+        types::gather(bs_b, indices.data(), indices.size(), results_b.data());
+        assert_that(std::vector<uint8_t>({0, 1, 1, 0, 1, 1}), is_equal(results_a));
+        assert_that(results_a, is_equal(results_b));
+    });
 });
@@ -0,0 +1,86 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_bucket_sieve.cxx
+/// @brief   testing of @ref math::prime::bucket_sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/bucket_sieve.h>
+#include <math/prime/range_sieve.h>
+#include <math/prime/count_primes.h>
+#include <math/prime/is_prime.h>
+#include <generator/select.h>
+#include <types/bitset.h>
+
+#include <vector>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return primes in [min_number, max_number] (using trial division)
+static std::vector<uint64_t> expected_primes(const uint64_t min_number, const uint64_t max_number) {
+    return generator::select(min_number, max_number, uint64_t(1))
+        .where([](const uint64_t number) {return math::prime::is_prime(number);})
+        .to_vector();
+}
+
+/// testing of class @ref math::prime::bucket_sieve
+describe_suite("testing math::prime::bucket_sieve", [](){
+    describe_test("testing small windows (compared with is_prime)", []() {
+        for (auto min_number = uint64_t(0); min_number <= 20; ++min_number) {
+            for (auto max_number = min_number; max_number <= min_number + 300; max_number += 29) {
+                math::prime::bucket_sieve<types::bitset<uint64_t>> sieve(min_number, max_number);
+                sieve.calculate();
+                const std::vector<uint64_t> primes(sieve.begin(), sieve.end());
+                assert_that(expected_primes(min_number, max_number), is_equal(primes));
+                assert_that(uint64_t(primes.size()), is_equal(sieve.count()));
+            }
+        }
+    });
+
+    describe_test("testing count (compared with count_primes)", []() {
+        for (const auto max_number: {uint64_t(1000000), uint64_t(10000000), uint64_t(100000000)}) {
+            const math::prime::bucket_sieve<types::bitset<uint64_t>> sieve(0, max_number);
+            assert_that(math::prime::count_primes(max_number), is_equal(sieve.count()));
+        }
+    });
+
+    describe_test("testing window behind the size of a segment (large primes only)", []() {
+        constexpr auto min_number = uint64_t(1000000000000);
+        constexpr auto max_number = min_number + 3000000;
+        const math::prime::bucket_sieve<types::bitset<uint64_t>> sieve(min_number, max_number);
+        math::prime::range_sieve<types::bitset<uint64_t>> expected(min_number, max_number);
+        expected.calculate();
+
+        std::vector<uint64_t> primes;
+        sieve.stream([&primes](const uint64_t prime) {primes.push_back(prime);});
+        assert_that(std::vector<uint64_t>(expected.begin(), expected.end()), is_equal(primes));
+        assert_that(uint64_t(primes.size()), is_equal(sieve.count()));
+    });
+
+    describe_test("testing is_prime outside of the window", []() {
+        math::prime::bucket_sieve<std::vector<bool>> sieve(100, 200);
+        sieve.calculate();
+
+        assert_that(false, is_equal(sieve.is_prime(97)));
+        assert_that(true, is_equal(sieve.is_prime(101)));
+        assert_that(false, is_equal(sieve.is_prime(211)));
+        assert_that(uint64_t(201), is_equal(sieve.next_prime(200)));
+    });
+});
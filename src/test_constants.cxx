@@ -0,0 +1,67 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_constants.cxx
+/// @brief   testing of @ref math::constants
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/constants.h>
+
+#include <string>
+
+using namespace unittest;
+using namespace matcher;
+
+/// testing of class @ref math::constants
+describe_suite("testing math::constants", [](){
+    /// testing @ref math::constants::pi
+    describe_test("testing pi", []() {
+        assert_that(std::string("3"), is_equal(math::constants::pi(0).to_string()));
+        assert_that(std::string("3141592653"), is_equal(math::constants::pi(9).to_string()));
+        assert_that(std::string("314159265358979323846264338327950288419716939937510"),
+                    is_equal(math::constants::pi(50).to_string()));
+
+        const auto text = math::constants::pi(1000).to_string();
+        assert_that(std::size_t(1001), is_equal(text.size()));
+        assert_that(std::string("130019278766111959092164201989"), is_equal(text.substr(text.size() - 30)));
+    });
+
+    /// testing @ref math::constants::e
+    describe_test("testing e", []() {
+        assert_that(std::string("2"), is_equal(math::constants::e(0).to_string()));
+        assert_that(std::string("271828182845904523536028747135266249775724709369995"),
+                    is_equal(math::constants::e(50).to_string()));
+
+        const auto text = math::constants::e(1000).to_string();
+        assert_that(std::size_t(1001), is_equal(text.size()));
+        assert_that(std::string("873969655212671546889570350354"), is_equal(text.substr(text.size() - 30)));
+    });
+
+    /// testing @ref math::constants::sqrt
+    describe_test("testing sqrt", []() {
+        assert_that(std::string("4000"), is_equal(math::constants::sqrt(16, 3).to_string()));
+        assert_that(std::string("141421356237309504880168872420969807856967187537694"),
+                    is_equal(math::constants::sqrt(2, 50).to_string()));
+        assert_that(std::string("10002499687578100594479"), is_equal(math::constants::sqrt(10005, 20).to_string()));
+
+        const auto text = math::constants::sqrt(2, 1000).to_string();
+        assert_that(std::size_t(1001), is_equal(text.size()));
+        assert_that(std::string("419758716582152128229518488472"), is_equal(text.substr(text.size() - 30)));
+    });
+});
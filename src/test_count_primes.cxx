@@ -0,0 +1,65 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_count_primes.cxx
+/// @brief   testing of @ref math::prime::count_primes
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/count_primes.h>
+#include <math/prime/sieve_of_eratosthenes.h>
+#include <types/bitset.h>
+
+#include <vector>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+/// testing of function @ref math::prime::count_primes
+describe_suite("testing math::prime::count_primes", [](){
+    describe_test("testing small values (compared with sieve)", []() {
+        constexpr auto max_number = 2000;
+        math::prime::sieve_of_eratosthenes<types::bitset<uint64_t>> sieve(max_number);
+        sieve.calculate();
+
+        auto expected = uint64_t(0);
+        for (auto number = uint64_t(0); number <= max_number; ++number) {
+            if (sieve.is_prime(number)) {
+                ++expected;
+            }
+            assert_that(expected, is_equal(math::prime::count_primes(number)));
+        }
+    });
+
+    describe_test("testing powers of ten", []() {
+        // see here: oeis.org/A006880
+        const std::vector<uint64_t> expected = {0, 4, 25, 168, 1229, 9592, 78498, 664579, 5761455, 50847534};
+        auto value = uint64_t(1);
+        for (const auto& count: expected) {
+            assert_that(count, is_equal(math::prime::count_primes(value)));
+            value *= 10;
+        }
+    });
+
+    describe_test("testing squares of primes (sieve limit is exact root)", []() {
+        assert_that(uint64_t(80), is_equal(math::prime::count_primes(409)));
+        assert_that(uint64_t(1163), is_equal(math::prime::count_primes(97 * 97)));
+        assert_that(uint64_t(1163), is_equal(math::prime::count_primes(97 * 97 + 1)));
+    });
+});
@@ -0,0 +1,174 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_decimal_limbs.cxx
+/// @brief   testing of @ref math::detail::decimal_limbs
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/decimal_limbs.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+using math::detail::decimal_limbs;
+
+/// @return decimal text of given limbs
+static std::string to_text(const decimal_limbs::limbs_type& value) {
+    std::stringstream stream;
+    decimal_limbs::write(stream, value);
+    return stream.str();
+}
+
+/// testing of class @ref math::detail::decimal_limbs
+describe_suite("testing math::detail::decimal_limbs", [](){
+    describe_test("testing add and subtract", []() {
+        assert_that(std::string("0"), is_equal(to_text(decimal_limbs::limbs_type())));
+        assert_that(std::string("1000000000"), is_equal(to_text(decimal_limbs::add({999999999}, {1}))));
+        assert_that(std::string("999999999"), is_equal(to_text(decimal_limbs::subtract({0, 1}, {1}))));
+        assert_that(std::string("0"), is_equal(to_text(decimal_limbs::subtract({5, 7}, {5, 7}))));
+    });
+
+    describe_test("testing multiply", []() {
+        assert_that(std::string("2246913578"), is_equal(to_text(decimal_limbs::multiply({123456789, 1}, {2}))));
+        assert_that(std::string("0"), is_equal(to_text(decimal_limbs::multiply({}, {2}))));
+
+        // (10^(9 * 100) - 1)^2 with Karatsuba compared with the school method
+        const decimal_limbs::limbs_type value(100, 999999999);
+        assert_that(true, is_equal(decimal_limbs::multiply_school(value, value)
+                                   == decimal_limbs::multiply(value, value)));
+        decimal_limbs::limbs_type other(77, 123456789);
+        other.push_back(5);
+        assert_that(true, is_equal(decimal_limbs::multiply_school(value, other)
+                                   == decimal_limbs::multiply(value, other)));
+    });
+
+    describe_test("testing double and halve", []() {
+        decimal_limbs::limbs_type value(1, 3);
+        decimal_limbs::double_in_place(value, 100);
+        // 3 * 2^100
+        assert_that(std::string("3802951800684688204490109616128"), is_equal(to_text(value)));
+        decimal_limbs::halve_in_place(value, 99);
+        assert_that(std::string("6"), is_equal(to_text(value)));
+    });
+
+    describe_test("testing divide", []() {
+        assert_that(std::string("123456789123456789"),
+                    is_equal(to_text(decimal_limbs::divide({246913578, 246913578, 0}, {2}))));
+        assert_that(std::string("0"), is_equal(to_text(decimal_limbs::divide({5}, {0, 1}))));
+        assert_raise<std::runtime_error>("division by zero", []() {
+            decimal_limbs::divide({5}, {});
+        });
+
+        // (x * y + rest) / y = x for a rest below y with reciprocals of several precision steps
+        decimal_limbs::limbs_type x(150, 123456789);
+        x.push_back(7);
+        decimal_limbs::limbs_type y(80, 987654321);
+        y.push_back(3);
+        const auto product = decimal_limbs::multiply(x, y);
+        assert_that(true, is_equal(x == decimal_limbs::divide(product, y)));
+        assert_that(true, is_equal(x == decimal_limbs::divide(decimal_limbs::add(product,
+                                                                                 decimal_limbs::subtract(y, {1})), y)));
+        assert_that(true, is_equal(decimal_limbs::subtract(x, {1})
+                                   == decimal_limbs::divide(decimal_limbs::subtract(product, {1}), y)));
+
+        // long division for a short divisor
+        const decimal_limbs::limbs_type z(40, 999999999);
+        const auto other = decimal_limbs::multiply(x, z);
+        assert_that(true, is_equal(x == decimal_limbs::divide(other, z)));
+        assert_that(true, is_equal(decimal_limbs::subtract(x, {1})
+                                   == decimal_limbs::divide(decimal_limbs::subtract(other, {1}), z)));
+    });
+
+    describe_test("testing remainder", []() {
+        assert_that(std::string("1"), is_equal(to_text(decimal_limbs::remainder({10}, {3}))));
+        assert_that(std::string("3"), is_equal(to_text(decimal_limbs::remainder({3}, {0, 1}))));
+        assert_that(std::string("0"), is_equal(to_text(decimal_limbs::remainder({0, 2}, {0, 1}))));
+
+        decimal_limbs::limbs_type x(150, 123456789);
+        decimal_limbs::limbs_type y(80, 987654321);
+        const auto product = decimal_limbs::multiply(x, y);
+        assert_that(true, is_equal(decimal_limbs::remainder(product, y).empty()));
+        const auto rest = decimal_limbs::remainder(decimal_limbs::add(product, {42}), x);
+        assert_that(true, is_equal(decimal_limbs::limbs_type{42} == rest));
+
+        decimal_limbs::limbs_type value{123456789, 987654321, 5};
+        assert_that(uint32_t(3), is_equal(decimal_limbs::divide_in_place(value, 7)));
+        assert_that(std::string("855379188731922398"), is_equal(to_text(value)));
+    });
+
+    describe_test("testing square_root", []() {
+        assert_that(std::string("0"), is_equal(to_text(decimal_limbs::square_root({}))));
+        assert_that(std::string("999999999"), is_equal(to_text(decimal_limbs::square_root({999999998, 999999999}))));
+        assert_that(std::string("1000000000"), is_equal(to_text(decimal_limbs::square_root({0, 0, 1}))));
+
+        decimal_limbs::limbs_type x(200, 555555555);
+        x.push_back(42);
+        const auto square = decimal_limbs::multiply(x, x);
+        assert_that(true, is_equal(x == decimal_limbs::square_root(square)));
+        assert_that(true, is_equal(x == decimal_limbs::square_root(decimal_limbs::add(square,
+                                                                                      decimal_limbs::add(x, x)))));
+        assert_that(true, is_equal(decimal_limbs::subtract(x, {1})
+                                   == decimal_limbs::square_root(decimal_limbs::subtract(square, {1}))));
+    });
+
+    describe_test("testing gcd", []() {
+        assert_that(std::string("12"), is_equal(to_text(decimal_limbs::gcd({36}, {120}))));
+        assert_that(std::string("7"), is_equal(to_text(decimal_limbs::gcd({}, {7}))));
+        assert_that(std::string("7"), is_equal(to_text(decimal_limbs::gcd({7}, {}))));
+
+        // gcd(x * 2^40 * 3, x * 2^35 * 5) = x * 2^35 with a factor 10^9 in x
+        decimal_limbs::limbs_type x(30, 111111111);
+        x.insert(x.begin(), 0);
+        auto lhs = decimal_limbs::multiply(x, {3});
+        decimal_limbs::double_in_place(lhs, 40);
+        auto rhs = decimal_limbs::multiply(x, {5});
+        decimal_limbs::double_in_place(rhs, 35);
+        auto expected = x;
+        decimal_limbs::double_in_place(expected, 35);
+        assert_that(true, is_equal(expected == decimal_limbs::gcd(lhs, rhs)));
+
+        // gcd(x * a, x * b) = x for coprime a = 10^900 - 1 and b = 10^900 + 1 (Lehmer steps)
+        const decimal_limbs::limbs_type a(100, 999999999);
+        const auto b = decimal_limbs::add(a, {2});
+        const auto gcd = decimal_limbs::gcd(decimal_limbs::multiply(x, a), decimal_limbs::multiply(x, b));
+        assert_that(true, is_equal(x == gcd));
+    });
+
+    describe_test("testing write", []() {
+        assert_that(std::string("1000000007"), is_equal(to_text({7, 1})));
+
+        // more digits than written at once: 1 followed by 100 times "000000042"
+        decimal_limbs::limbs_type value(100, 42);
+        value.push_back(1);
+        std::string expected("1");
+        for (auto index = 0; index < 100; ++index) {
+            expected += "000000042";
+        }
+        assert_that(expected, is_equal(to_text(value)));
+    });
+
+    describe_test("testing conversion to big integer", []() {
+        assert_that(std::string("1000000007"), is_equal(decimal_limbs::to_big_integer({7, 1}).to_string()));
+    });
+});
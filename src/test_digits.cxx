@@ -23,6 +23,8 @@
 #include <unittest/unittest.h>
 #include <math/digits.h>
 #include <generator/select.h>
+#include <algorithm>
+#include <vector>
 
 using namespace unittest;
 using namespace matcher;
@@ -59,6 +61,137 @@ describe_suite("testing math::digits", [](){
         assert_that(false, is_equal(math::digits<int>::is_pandigital(123445)));
         assert_that(false, is_equal(math::digits<int>::is_pandigital(123445)));
         assert_that(false, is_equal(math::digits<int>::is_pandigital(123005)));
+
+        // single digits, pairs with equal digits and negative numbers (0 is not pandigital)
+        assert_that(false, is_equal(math::digits<int>::is_pandigital(0)));
+        assert_that(true, is_equal(math::digits<int>::is_pandigital(7)));
+        assert_that(false, is_equal(math::digits<int>::is_pandigital(11)));
+        assert_that(false, is_equal(math::digits<int>::is_pandigital(1011)));
+        assert_that(true, is_equal(math::digits<int>::is_pandigital(-1230)));
+        assert_that(true, is_equal(math::digits<uint64_t>::is_pandigital(9876543210ULL)));
+        assert_that(false, is_equal(math::digits<uint64_t>::is_pandigital(19876543210ULL)));
+    });
+
+    /// testing @ref math::digits::is_palindrome
+    describe_test("testing is_palindrome", []() {
+        assert_that(true, is_equal(math::digits<int>::is_palindrome(0)));
+        assert_that(true, is_equal(math::digits<int>::is_palindrome(7)));
+        assert_that(true, is_equal(math::digits<int>::is_palindrome(55)));
+        assert_that(true, is_equal(math::digits<int>::is_palindrome(161)));
+        assert_that(true, is_equal(math::digits<int>::is_palindrome(2332)));
+        assert_that(true, is_equal(math::digits<int>::is_palindrome(-12321)));
+        assert_that(true, is_equal(math::digits<uint64_t>::is_palindrome(12345678987654321ULL)));
+        assert_that(true, is_equal(math::digits<uint64_t>::is_palindrome(10000000000000000001ULL)));
+
+        assert_that(false, is_equal(math::digits<int>::is_palindrome(10)));
+        assert_that(false, is_equal(math::digits<int>::is_palindrome(1021)));
+        assert_that(false, is_equal(math::digits<int>::is_palindrome(32233)));
+        assert_that(false, is_equal(math::digits<uint64_t>::is_palindrome(18446744073709551615ULL)));
+    });
+
+    /// testing @ref math::digits::reverse
+    describe_test("testing reverse", []() {
+        assert_that(0, is_equal(math::digits<int>::reverse(0)));
+        assert_that(54321, is_equal(math::digits<int>::reverse(12345)));
+        assert_that(4321, is_equal(math::digits<int>::reverse(123400)));
+        assert_that(-321, is_equal(math::digits<int>::reverse(-123)));
+        assert_that(-3, is_equal(math::digits<int>::sum(-12)));
+    });
+
+    /// comparing the two digit kernels with a digit by digit reference
+    describe_test("testing kernels against digit by digit reference", []() {
+        auto mismatches = 0;
+        for (auto number = 0; number < 200000; ++number) {
+            std::vector<int> digits;
+            auto mask = 0;
+            auto unique = true;
+            auto sum = 0;
+            auto reversed = 0;
+            for (auto n = number; n != 0; n /= 10) {
+                digits.push_back(n % 10);
+                unique = unique && (mask & (1 << (n % 10))) == 0;
+                mask |= 1 << (n % 10);
+                sum += n % 10;
+                reversed = reversed * 10 + n % 10;
+            }
+
+            const auto length = std::max(static_cast<int>(digits.size()), 1);
+            const auto palindrome = std::equal(digits.begin(), digits.end(), digits.rbegin());
+            if (math::digits<int>::count(number) != length
+                || math::digits<int>::sum(number) != sum
+                || math::digits<int>::reverse(number) != reversed
+                || math::digits<int>::is_pandigital(number) != (unique && number != 0)
+                || math::digits<int>::is_palindrome(number) != palindrome) {
+                ++mismatches;
+            }
+        }
+        assert_that(0, is_equal(mismatches));
+    });
+
+    /// testing @ref math::digits::is_pandigital_batch and @ref math::digits::is_palindrome_batch
+    describe_test("testing batch versions", []() {
+        const std::vector<uint64_t> numbers = {2, 11, 101, 1231, 9876543210ULL, 12345678987654321ULL};
+        std::vector<uint8_t> results(numbers.size(), 2);
+
+        math::digits<uint64_t>::is_pandigital_batch(numbers.data(), numbers.size(), results.data());
+        assert_that(true, is_equal(std::vector<uint8_t>({1, 0, 0, 0, 1, 0}) == results));
+
+        math::digits<uint64_t>::is_palindrome_batch(numbers.data(), numbers.size(), results.data());
+        assert_that(true, is_equal(std::vector<uint8_t>({1, 1, 1, 0, 0, 1}) == results));
+    });
+
+    /// testing @ref math::digits::for_each_palindrome
+    describe_test("testing for_each_palindrome", []() {
+        std::vector<int> palindromes;
+        math::digits<int>::for_each_palindrome(-5, 130, [&palindromes](const int n) {palindromes.push_back(n);});
+        const auto expected = std::vector<int>({
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 22, 33, 44, 55, 66, 77, 88, 99, 101, 111, 121});
+        assert_that(expected, is_equal(palindromes));
+
+        // same as filtering all numbers (in increasing order)
+        std::vector<int> generated;
+        math::digits<int>::for_each_palindrome(1234, 234567, [&generated](const int n) {generated.push_back(n);});
+        const auto filtered = generator::select(1234, 234567, 1)
+            .where([](const int& n) {return math::digits<int>::is_palindrome(n);})
+            .to_vector();
+        assert_that(true, is_equal(filtered == generated));
+
+        // stopping at the upper limit without overflow
+        std::vector<uint64_t> biggest;
+        math::digits<uint64_t>::for_each_palindrome(18446744060000000000ULL, 18446744073709551615ULL,
+            [&biggest](const uint64_t n) {biggest.push_back(n);});
+        assert_that(true, is_equal(std::vector<uint64_t>({18446744066044764481ULL}) == biggest));
+
+        auto count = 0;
+        math::digits<int>::for_each_palindrome(1000000, 1099999, [&count](const int) {++count;});
+        assert_that(100, is_equal(count));
+        math::digits<int>::for_each_palindrome(200, 100, [&count](const int) {++count;});
+        assert_that(100, is_equal(count));
+    });
+
+    /// testing @ref math::digits::for_each_pandigital
+    describe_test("testing for_each_pandigital", []() {
+        std::vector<int> pandigitals;
+        math::digits<int>::for_each_pandigital(-1, 13, [&pandigitals](const int n) {pandigitals.push_back(n);});
+        assert_that(std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13}), is_equal(pandigitals));
+
+        // same as filtering all numbers (in increasing order)
+        std::vector<int> generated;
+        math::digits<int>::for_each_pandigital(987, 234567, [&generated](const int n) {generated.push_back(n);});
+        const auto filtered = generator::select(987, 234567, 1)
+            .where([](const int& n) {return math::digits<int>::is_pandigital(n);})
+            .to_vector();
+        assert_that(true, is_equal(filtered == generated));
+
+        auto count = 0;
+        math::digits<int>::for_each_pandigital(0, 999999, [&count](const int) {++count;});
+        assert_that(168571, is_equal(count));
+
+        // the biggest one has 10 digits
+        auto last = uint64_t(0);
+        math::digits<uint64_t>::for_each_pandigital(9876543000ULL, 18446744073709551615ULL,
+            [&last](const uint64_t n) {last = n;});
+        assert_that(uint64_t(9876543210ULL), is_equal(last));
     });
 });
 
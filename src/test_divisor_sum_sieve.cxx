@@ -0,0 +1,61 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_divisor_sum_sieve.cxx
+/// @brief   testing of @ref math::divisor_sum_sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/divisor_sum_sieve.h>
+#include <math/factorization.h>
+
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+/// testing of class @ref math::divisor_sum_sieve
+describe_suite("testing math::divisor_sum_sieve", [](){
+    describe_test("testing sum of divisors", []() {
+        // more than two segments
+        math::divisor_sum_sieve<uint32_t> sieve(100000);
+        sieve.calculate();
+
+        assert_that(uint64_t(100000), is_equal(sieve.max_number()));
+        assert_that(uint32_t(0), is_equal(sieve.sum_of_divisors(0)));
+        assert_that(uint32_t(1), is_equal(sieve.sum_of_divisors(1)));
+        assert_that(uint32_t(28), is_equal(sieve.sum_of_divisors(12)));
+        assert_that(uint32_t(16), is_equal(sieve.sum_of_proper_divisors(12)));
+
+        for (auto number = uint32_t(1); number <= 100000; ++number) {
+            assert_that(math::factorization<uint32_t>::sum_of_divisors(number),
+                        is_equal(uint64_t(sieve.sum_of_divisors(number))));
+        }
+    });
+
+    describe_test("testing small limits", []() {
+        math::divisor_sum_sieve<> sieve_a(0);
+        sieve_a.calculate();
+        assert_that(uint64_t(0), is_equal(sieve_a.sum_of_divisors(0)));
+
+        math::divisor_sum_sieve<> sieve_b(4);
+        sieve_b.calculate();
+        assert_that(uint64_t(7), is_equal(sieve_b.sum_of_divisors(4)));
+        assert_that(uint64_t(4), is_equal(sieve_b.sum_of_divisors(3)));
+    });
+});
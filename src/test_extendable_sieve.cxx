@@ -0,0 +1,96 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_extendable_sieve.cxx
+/// @brief   testing of @ref math::prime::extendable_sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/extendable_sieve.h>
+#include <math/prime/is_prime.h>
+#include <generator/select.h>
+#include <types/bitset.h>
+
+#include <vector>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return primes up to given limit (using trial division)
+static std::vector<uint64_t> expected_primes(const uint64_t max_number) {
+    return generator::select(uint64_t(0), max_number, uint64_t(1))
+        .where([](const uint64_t number) {return math::prime::is_prime(number);})
+        .to_vector();
+}
+
+/// testing of class @ref math::prime::extendable_sieve
+describe_suite("testing math::prime::extendable_sieve", [](){
+    describe_test("testing sieve 5000 (compared with is_prime)", []() {
+        constexpr auto max_number = 5000;
+        math::prime::extendable_sieve<std::vector<bool>> sieve(max_number);
+        sieve.calculate();
+
+        assert_that(uint64_t(max_number), is_equal(sieve.max_number()));
+        for (auto number = 0; number <= max_number; ++number) {
+            assert_that(math::prime::is_prime(number), is_equal(sieve.is_prime(number)));
+        }
+        assert_that(false, is_equal(sieve.is_prime(5003)));
+    });
+
+    describe_test("testing extending in small steps", []() {
+        math::prime::extendable_sieve<types::bitset<uint64_t>> sieve(10);
+        sieve.calculate();
+
+        for (auto max_number = uint64_t(11); max_number <= 1000; max_number += 7) {
+            sieve.extend_to(max_number);
+            assert_that(max_number, is_equal(sieve.max_number()));
+            const std::vector<uint64_t> primes(sieve.begin(), sieve.end());
+            assert_that(expected_primes(max_number), is_equal(primes));
+        }
+    });
+
+    describe_test("testing extending behind the square of the limit", []() {
+        math::prime::extendable_sieve<types::bitset<uint64_t>> sieve(5);
+        sieve.calculate();
+        sieve.extend_to(20000);
+        sieve.extend_to(100);
+
+        assert_that(uint64_t(20000), is_equal(sieve.max_number()));
+        const std::vector<uint64_t> primes(sieve.begin(), sieve.end());
+        assert_that(expected_primes(20000), is_equal(primes));
+    });
+
+    describe_test("testing automatic extension", []() {
+        math::prime::extendable_sieve<types::bitset<uint64_t>> sieve(100);
+        sieve.calculate();
+
+        assert_that(false, is_equal(sieve.is_prime(101)));
+        assert_that(uint64_t(100), is_equal(sieve.max_number()));
+        assert_that(true, is_equal(sieve.extending_is_prime(101)));
+        assert_that(uint64_t(200), is_equal(sieve.max_number()));
+        assert_that(true, is_equal(sieve.extending_is_prime(99991)));
+        assert_that(uint64_t(99991), is_equal(sieve.max_number()));
+        assert_that(false, is_equal(sieve.extending_is_prime(99993)));
+        assert_that(uint64_t(2 * 99991), is_equal(sieve.max_number()));
+
+        std::vector<uint64_t> primes;
+        sieve.for_each_prime(99900, 100000, [&primes](const uint64_t prime) {primes.push_back(prime);});
+        assert_that(std::vector<uint64_t>({99901, 99907, 99923, 99929, 99961, 99971, 99989, 99991}),
+                    is_equal(primes));
+    });
+});
@@ -23,6 +23,8 @@
 #include <unittest/unittest.h>
 #include <math/factorization.h>
 
+#include <numeric>
+
 using namespace unittest;
 using namespace matcher;
 
@@ -37,6 +39,49 @@ describe_suite("testing math::factorization", [](){
         assert_that(DIVISORS({1, 2, 3, 4, 6, 8, 12, 24}), is_equal(divisors));
         math::factorization<int>::probe(100, divisors);
         assert_that(DIVISORS({1, 2, 4, 5, 10, 20, 25, 50, 100}), is_equal(divisors));
+        math::factorization<int>::probe(1, divisors);
+        assert_that(DIVISORS({1}), is_equal(divisors));
+        math::factorization<int>::probe(97, divisors);
+        assert_that(DIVISORS({1, 97}), is_equal(divisors));
+        math::factorization<int>::probe(0, divisors);
+        assert_that(DIVISORS({1, 0}), is_equal(divisors));
+    });
+
+    describe_test("testing prime factors", []() {
+        math::factorization<int>::factors_type factors;
+
+        math::factorization<int>::prime_factors(360, factors);
+        assert_that(true, is_equal(factors == math::factorization<int>::factors_type({{2, 3}, {3, 2}, {5, 1}})));
+        math::factorization<int>::prime_factors(1, factors);
+        assert_that(true, is_equal(factors.empty()));
+        math::factorization<int>::prime_factors(9973 * 2, factors);
+        assert_that(true, is_equal(factors == math::factorization<int>::factors_type({{2, 1}, {9973, 1}})));
+    });
+
+    describe_test("testing divisors from prime factors", []() {
+        math::factorization<int>::factors_type factors;
+        DIVISORS divisors;
+        DIVISORS expected;
+
+        for (auto number = 1; number <= 2000; ++number) {
+            math::factorization<int>::prime_factors(number, factors);
+            math::factorization<int>::divisors(factors, divisors);
+            math::factorization<int>::probe(number, expected);
+            assert_that(expected, is_equal(divisors));
+        }
+    });
+
+    describe_test("testing sum of divisors", []() {
+        DIVISORS divisors;
+        for (auto number = 1; number <= 2000; ++number) {
+            math::factorization<int>::probe(number, divisors);
+            assert_that(std::accumulate(divisors.begin(), divisors.end(), uint64_t(0)),
+                        is_equal(math::factorization<int>::sum_of_divisors(number)));
+        }
+
+        assert_that(uint64_t(1), is_equal(math::factorization<int>::sum_of_divisors(0)));
+        // sigma(65520) = 270816 does not fit into 16 bit
+        assert_that(uint64_t(270816), is_equal(math::factorization<uint16_t>::sum_of_divisors(65520)));
     });
 });
 
@@ -0,0 +1,61 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_factorize_u64.cxx
+/// @brief   testing of @ref math::factorize_u64
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/factorize_u64.h>
+#include <math/factorization.h>
+
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+using FACTORS = math::factorization<uint64_t>::factors_type;
+
+/// testing of function @ref math::factorize_u64
+describe_suite("testing math::factorize_u64", [](){
+    describe_test("testing small numbers", []() {
+        assert_that(true, is_equal(math::factorize_u64(0).empty()));
+        assert_that(true, is_equal(math::factorize_u64(1).empty()));
+        assert_that(true, is_equal(FACTORS({{2, 3}, {3, 2}, {5, 1}}) == math::factorize_u64(360)));
+
+        FACTORS expected;
+        for (auto number = uint64_t(2); number <= 20000; ++number) {
+            math::factorization<uint64_t>::prime_factors(number, expected);
+            assert_that(true, is_equal(expected == math::factorize_u64(number)));
+        }
+    });
+
+    describe_test("testing big numbers", []() {
+        assert_that(true, is_equal(FACTORS({{3, 1}, {5, 1}, {17, 1}, {257, 1}, {641, 1}, {65537, 1}, {6700417, 1}})
+                                   == math::factorize_u64(18446744073709551615ULL)));
+        assert_that(true, is_equal(FACTORS({{4294967279ULL, 1}, {4294967291ULL, 1}})
+                                   == math::factorize_u64(18446743979220271189ULL)));
+        assert_that(true, is_equal(FACTORS({{4294967291ULL, 2}}) == math::factorize_u64(18446744030759878681ULL)));
+        assert_that(true, is_equal(FACTORS({{998244353ULL, 1}, {1000000007ULL, 1}})
+                                   == math::factorize_u64(998244359987710471ULL)));
+        assert_that(true, is_equal(FACTORS({{3, 1}, {4294967291ULL, 1}}) == math::factorize_u64(12884901873ULL)));
+        assert_that(true, is_equal(FACTORS({{18446744073709551557ULL, 1}})
+                                   == math::factorize_u64(18446744073709551557ULL)));
+        assert_that(true, is_equal(FACTORS({{2, 63}}) == math::factorize_u64(uint64_t(1) << 63)));
+    });
+});
@@ -23,6 +23,8 @@
 #include <unittest/unittest.h>
 #include <math/fibonacci.h>
 
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <cstdint>
 
@@ -41,5 +43,42 @@ describe_suite("testing math::fibonacci", [](){
                         is_equal(math::fibonacci::by_index(index)));
         }
     });
+
+    describe_test("testing @ref math::fibonacci::by_index_u64 function", []() {
+        std::vector<uint64_t> values;
+        math::fibonacci::sequence(94, values);
+        assert_that(std::size_t(94), is_equal(values.size()));
+
+        for (auto index = uint32_t(0); index < 94; ++index) {
+            assert_that(values[index], is_equal(math::fibonacci::by_index_u64(index)));
+        }
+        assert_that(uint64_t(12200160415121876738ULL), is_equal(math::fibonacci::by_index_u64(93)));
+
+        assert_raise<std::overflow_error>("fibonacci value does not fit into 64 bit",
+                                          []() { math::fibonacci::by_index_u64(94); });
+        assert_raise<std::overflow_error>("fibonacci value does not fit into 64 bit",
+                                          [&values]() { math::fibonacci::sequence(95, values); });
+    });
+
+    describe_test("testing @ref math::fibonacci::by_index_big function", []() {
+        std::vector<math::big_integer> values;
+        math::fibonacci::sequence(400, values);
+        assert_that(std::size_t(400), is_equal(values.size()));
+
+        for (auto index = uint32_t(0); index < 400; ++index) {
+            assert_that(values[index].to_string(), is_equal(math::fibonacci::by_index_big(index).to_string()));
+        }
+
+        assert_that(std::string("43466557686937456435688527675040625802564660517371780402481729089536555417949051890"
+                                "40387984007925516929592259308032263477520968962323987332247116164299644090653318793"
+                                "8298969649928516003704476137795166849228875"),
+                    is_equal(math::fibonacci::by_index_big(1000).to_string()));
+
+        // F(100000) has 20899 digits
+        const auto value = math::fibonacci::by_index_big(100000).to_string();
+        assert_that(std::size_t(20899), is_equal(value.size()));
+        assert_that(std::string("259740693472217241661550340212"), is_equal(value.substr(0, 30)));
+        assert_that(std::string("289236362349895374653428746875"), is_equal(value.substr(value.size() - 30)));
+    });
 });
 
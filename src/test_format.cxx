@@ -0,0 +1,121 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_format.cxx
+/// @brief   testing of @ref types::to_chars and @ref types::output_sink
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <types/format.h>
+#include <sstream>
+#include <string>
+#include <limits>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return decimal characters of given value written by @ref types::to_chars
+template <typename T>
+static std::string format(const T value) {
+    char buffer[types::MAX_DECIMAL_CHARS];
+    return std::string(buffer, types::to_chars(buffer, value));
+}
+
+/// testing of @ref types::to_chars and @ref types::output_sink
+describe_suite("testing types::format", [](){
+    /// testing @ref types::count_decimal_digits
+    describe_test("testing count_decimal_digits", []() {
+        assert_that(uint32_t(1), is_equal(types::count_decimal_digits(0)));
+        assert_that(uint32_t(1), is_equal(types::count_decimal_digits(9)));
+        assert_that(uint32_t(2), is_equal(types::count_decimal_digits(10)));
+        assert_that(uint32_t(5), is_equal(types::count_decimal_digits(99999)));
+        assert_that(uint32_t(20), is_equal(types::count_decimal_digits(std::numeric_limits<uint64_t>::max())));
+
+        auto power = uint64_t(1);
+        for (auto digits = uint32_t(1); digits < 20; ++digits, power *= 10) {
+            assert_that(digits, is_equal(types::count_decimal_digits(power)));
+            assert_that(digits + 1, is_equal(types::count_decimal_digits(power * 10)));
+        }
+    });
+
+    /// testing @ref types::to_chars
+    describe_test("testing to_chars", []() {
+        assert_that(std::string("0"), is_equal(format(0)));
+        assert_that(std::string("7"), is_equal(format(7u)));
+        assert_that(std::string("1234567"), is_equal(format(1234567)));
+        assert_that(std::string("-1234"), is_equal(format(-1234)));
+        assert_that(std::string("18446744073709551615"), is_equal(format(std::numeric_limits<uint64_t>::max())));
+        assert_that(std::string("-9223372036854775808"), is_equal(format(std::numeric_limits<int64_t>::min())));
+        assert_that(std::string("255"), is_equal(format(static_cast<unsigned char>(255))));
+
+        // same as the stream output
+        auto mismatches = 0;
+        for (auto value = -100000; value <= 100000; value += 7) {
+            std::stringstream stream;
+            stream << value;
+            if (stream.str() != format(value)) {
+                ++mismatches;
+            }
+        }
+        assert_that(0, is_equal(mismatches));
+    });
+
+    /// testing @ref types::to_chars_zero_padded
+    describe_test("testing to_chars_zero_padded", []() {
+        char buffer[types::MAX_DECIMAL_CHARS];
+        assert_that(std::string("000001234"), is_equal(std::string(buffer,
+            types::to_chars_zero_padded(buffer, 1234, 9))));
+        assert_that(std::string("34"), is_equal(std::string(buffer, types::to_chars_zero_padded(buffer, 1234, 2))));
+        assert_that(std::string("234"), is_equal(std::string(buffer, types::to_chars_zero_padded(buffer, 1234, 3))));
+        assert_that(std::string(""), is_equal(std::string(buffer, types::to_chars_zero_padded(buffer, 1234, 0))));
+    });
+
+    /// testing @ref types::output_sink
+    describe_test("testing output_sink", []() {
+        std::stringstream stream;
+        {
+            types::output_sink sink(stream);
+            sink.write(12).write(' ').write(-3, 4).write(5u, 1).write_zero_padded(42, 4);
+            sink.write("|").write(std::string("x"));
+        }
+        assert_that(std::string("12   -350042|x"), is_equal(stream.str()));
+
+        // more than the capacity of the buffer
+        std::stringstream big;
+        {
+            types::output_sink sink(big);
+            for (auto value = 0; value < 100000; ++value) {
+                sink.write(value, 6);
+            }
+            sink.flush();
+            assert_that(std::size_t(600000), is_equal(big.str().size()));
+        }
+        assert_that(std::string("     0     1"), is_equal(big.str().substr(0, 12)));
+        assert_that(std::string(" 99999"), is_equal(big.str().substr(599994)));
+
+        // a C string longer than the buffer is copied in blocks
+        const std::string text(2 * types::output_sink::CAPACITY + 5, 'a');
+        std::stringstream long_text;
+        {
+            types::output_sink sink(long_text);
+            sink.write('b').write(text.c_str());
+        }
+        assert_that("b" + text, is_equal(long_text.str()));
+    });
+});
@@ -22,6 +22,11 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <unittest/unittest.h>
 #include <math/fraction.h>
+
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <cstdint>
 
 using namespace unittest;
@@ -55,8 +60,8 @@ describe_suite("testing math::fraction", [](){
         constexpr math::fraction<int32_t> f1(2, 3);
         constexpr math::fraction<int32_t> f2(3, 5);
         constexpr math::fraction<int32_t> f3 = f1 * f2;
-        assert_that(6, is_equal(f3.get_numerator()));
-        assert_that(15, is_equal(f3.get_denominator()));
+        assert_that(2, is_equal(f3.get_numerator()));
+        assert_that(5, is_equal(f3.get_denominator()));
     });
 
     describe_test("testing product of two fractions", []() {
@@ -78,6 +83,88 @@ describe_suite("testing math::fraction", [](){
         assert_that(f4, is_equal(f1));
     });
 
+    describe_test("testing reduction", []() {
+        constexpr math::fraction<int32_t> f1(6, -15);
+        assert_that(-2, is_equal(f1.get_numerator()));
+        assert_that(5, is_equal(f1.get_denominator()));
+
+        constexpr math::fraction<int32_t> f2(0, -7);
+        assert_that(0, is_equal(f2.get_numerator()));
+        assert_that(1, is_equal(f2.get_denominator()));
+
+        constexpr math::fraction<int32_t> f3 = math::fraction<int32_t>(1, 6) + math::fraction<int32_t>(1, 3);
+        assert_that(1, is_equal(f3.get_numerator()));
+        assert_that(2, is_equal(f3.get_denominator()));
+
+        assert_that(uint64_t(12), is_equal(uint64_t(math::fraction<int64_t>::gcd(36, 120))));
+        assert_raise<std::runtime_error>("denominator of a fraction is 0", []() {
+            math::fraction<int32_t>(1, 0);
+        });
+        assert_raise<std::runtime_error>("denominator of a fraction is 0", []() {
+            math::fraction<int32_t>(1, 2) / math::fraction<int32_t>(0, 1);
+        });
+    });
+
+    describe_test("testing 64 bit fractions with 128 bit intermediate results", []() {
+        const auto max = std::numeric_limits<uint64_t>::max();
+        const auto one = math::fraction<uint64_t>(max, 3) * math::fraction<uint64_t>(3, max);
+        assert_that(uint64_t(1), is_equal(one.get_numerator()));
+        assert_that(uint64_t(1), is_equal(one.get_denominator()));
+
+        const auto power = int64_t(1) << 62;
+        const auto sum = math::fraction<int64_t>(1, power) + math::fraction<int64_t>(1, power);
+        assert_that(int64_t(1), is_equal(sum.get_numerator()));
+        assert_that(power / 2, is_equal(sum.get_denominator()));
+
+        const auto minimum = math::fraction<int64_t>(std::numeric_limits<int64_t>::min(), 1);
+        assert_that(std::numeric_limits<int64_t>::min(), is_equal(minimum.get_numerator()));
+
+        // harmonic number H(40): the unreduced terms are overflowing after a few steps
+        auto harmonic = math::fraction<int64_t>(0, 1);
+        for (auto k = int64_t(1); k <= 40; ++k) {
+            harmonic = harmonic + math::fraction<int64_t>(1, k);
+        }
+        assert_that(int64_t(2078178381193813), is_equal(harmonic.get_numerator()));
+        assert_that(int64_t(485721041551200), is_equal(harmonic.get_denominator()));
+
+        assert_raise<std::overflow_error>("fraction does not fit into the value type", [power]() {
+            math::fraction<int64_t>(1, power) + math::fraction<int64_t>(1, power - 1);
+        });
+        assert_raise<std::overflow_error>("fraction does not fit into the value type", [max]() {
+            math::fraction<uint64_t>(max, 1) + math::fraction<uint64_t>(max, 1);
+        });
+        assert_raise<std::overflow_error>("fraction does not fit into the value type", []() {
+            math::fraction<uint32_t>(1, 2) - math::fraction<uint32_t>(2, 3);
+        });
+    });
+
+    describe_test("testing big integer fractions", []() {
+        using big_fraction = math::fraction<math::big_integer>;
+        auto harmonic = big_fraction(0, 1);
+        for (auto k = 1; k <= 200; ++k) {
+            harmonic = harmonic + big_fraction(1, k);
+        }
+        assert_that(std::string("7343045013936630474541289203706909900117016127564"
+                                "0475032430988199840965762047744114895233"),
+                    is_equal(harmonic.get_numerator().to_string()));
+        assert_that(std::string("1249235514196023202368391728869782990490349565870"
+                                "9527193661000811749408076321384817296000"),
+                    is_equal(harmonic.get_denominator().to_string()));
+
+        assert_that(big_fraction(2, 5), is_equal(big_fraction(2, 3) * big_fraction(3, 5)));
+        assert_that(big_fraction(10, 9), is_equal(big_fraction(2, 3) / big_fraction(3, 5)));
+        assert_that(big_fraction(1, 6), is_equal(big_fraction(1, 2) - big_fraction(1, 3)));
+        assert_that(big_fraction(0, 1), is_equal(big_fraction(1, 3) - big_fraction(2, 6)));
+
+        std::stringstream stream;
+        stream << big_fraction(12, 30);
+        assert_that(std::string("fraction(2, 5)"), is_equal(stream.str()));
+
+        assert_raise<std::runtime_error>("difference of the fractions is negative", []() {
+            big_fraction(1, 3) - big_fraction(1, 2);
+        });
+    });
+
     describe_test("testing stream", []() {
         constexpr math::fraction<int32_t> f(1, 2);
         std::stringstream stream;
@@ -0,0 +1,50 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_index_sequence.cxx
+/// @brief   testing of @ref types::make_index_sequence
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <types/type_traits.h>
+
+#include <cstddef>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return sum of the indices of given sequence
+template <std::size_t... I>
+static std::size_t sum_of(types::index_sequence<I...>) {
+    std::size_t result = 0;
+    for (const auto index: {std::size_t(0), I...}) {
+        result += index;
+    }
+    return result;
+}
+
+/// testing of @ref types::make_index_sequence
+describe_suite("testing types::make_index_sequence", []() {
+    describe_test("testing size and content", []() {
+        assert_that(std::size_t(0), is_equal(types::make_index_sequence<0>::size()));
+        assert_that(std::size_t(1), is_equal(types::make_index_sequence<1>::size()));
+        assert_that(std::size_t(1000), is_equal(types::make_index_sequence<1000>::size()));
+        assert_that(std::size_t(999 * 1000 / 2), is_equal(sum_of(types::make_index_sequence<1000>())));
+        assert_that(std::size_t(3), is_equal(sum_of(types::make_index_sequence<3>())));
+    });
+});
@@ -0,0 +1,142 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_isqrt.cxx
+/// @brief   testing of @ref math::isqrt and @ref math::is_square
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/isqrt.h>
+#include <string>
+#include <limits>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return big integer for given decimal digits
+static math::big_integer from_string(const std::string& text) {
+    math::digits_type digits;
+    for (auto it = text.rbegin(); it != text.rend(); ++it) {
+        digits.push_back(static_cast<math::digit_type>(*it - '0'));
+    }
+    return math::big_integer(digits);
+}
+
+/// testing of @ref math::isqrt and @ref math::is_square
+describe_suite("testing math::isqrt", [](){
+    /// testing @ref math::isqrt for standard integers
+    describe_test("testing isqrt", []() {
+        assert_that(0, is_equal(math::isqrt(0)));
+        assert_that(1, is_equal(math::isqrt(3)));
+        assert_that(2, is_equal(math::isqrt(4)));
+        assert_that(0, is_equal(math::isqrt(-4)));
+        assert_that(uint64_t(4294967295ULL), is_equal(math::isqrt(std::numeric_limits<uint64_t>::max())));
+        assert_that(uint64_t(4294967291ULL), is_equal(math::isqrt(uint64_t(18446744030759878681ULL))));
+        assert_that(uint64_t(4294967290ULL), is_equal(math::isqrt(uint64_t(18446744030759878680ULL))));
+
+        // exact around all squares near 2^32 (double precision is not enough above 2^53)
+        auto mismatches = 0;
+        for (auto root = uint64_t(4294967295ULL); root > 4294967295ULL - 100000; --root) {
+            if (math::isqrt(root * root) != root || math::isqrt(root * root - 1) != root - 1) {
+                ++mismatches;
+            }
+        }
+        assert_that(0, is_equal(mismatches));
+
+        const auto wide = static_cast<math::uint128_type>(uint64_t(12345678901ULL)) * uint64_t(12345678901ULL);
+        assert_that(uint64_t(12345678901ULL), is_equal(math::isqrt(wide)));
+        assert_that(uint64_t(12345678900ULL), is_equal(math::isqrt(wide - 1)));
+
+        // up to the biggest 128 bit value (the root of the double is rounded up to 2^64 there)
+        const auto max = ~math::uint128_type(0);
+        const auto max_root = uint64_t(18446744073709551615ULL);
+        const auto square = static_cast<math::uint128_type>(max_root) * max_root;
+        assert_that(max_root, is_equal(math::isqrt(max)));
+        assert_that(max_root, is_equal(math::isqrt(square)));
+        assert_that(max_root - 1, is_equal(math::isqrt(square - 1)));
+        assert_that(uint64_t(13043817825332782212ULL), is_equal(math::isqrt(math::uint128_type(1) << 127)));
+        assert_that(true, is_equal(math::is_square(square)));
+        assert_that(false, is_equal(math::is_square(max)));
+    });
+
+    /// testing @ref math::is_square and @ref math::may_be_square
+    describe_test("testing is_square", []() {
+        auto mismatches = 0;
+        auto rejected = 0;
+        for (auto value = uint64_t(0); value < 1000000; ++value) {
+            const auto root = math::isqrt(value);
+            if (math::is_square(value) != (root * root == value)) {
+                ++mismatches;
+            }
+            if (!math::may_be_square(value)) {
+                ++rejected;
+            }
+        }
+        assert_that(0, is_equal(mismatches));
+        // 99.6% of the non-squares are rejected without a root
+        assert_that(true, is_equal(rejected > 995000));
+
+        assert_that(false, is_equal(math::is_square(-4)));
+        assert_that(true, is_equal(math::is_square(uint64_t(18446744030759878681ULL))));
+        assert_that(false, is_equal(math::is_square(uint64_t(18446744030759878682ULL))));
+        assert_that(false, is_equal(math::is_square(std::numeric_limits<uint64_t>::max())));
+    });
+
+    /// testing @ref math::isqrt and @ref math::is_square for big integers
+    describe_test("testing isqrt for big_integer", []() {
+        auto power = math::big_integer(1);
+        for (auto exponent = 0; exponent < 200; ++exponent) {
+            power *= math::big_integer(3);
+        }
+        assert_that(std::string("515377520732011331036461129765621272702107522001"),
+                    is_equal(math::isqrt(power).to_string()));
+        assert_that(true, is_equal(math::is_square(power)));
+
+        assert_that(std::string("3162277660168379331998893544432"),
+                    is_equal(math::isqrt(from_string("1" + std::string(61, '0'))).to_string()));
+
+        const auto root = from_string("12345678901234567890123456789");
+        auto square = root * root;
+        assert_that(root.to_string(), is_equal(math::isqrt(square).to_string()));
+        assert_that(true, is_equal(math::is_square(square)));
+        square += 1;
+        assert_that(root.to_string(), is_equal(math::isqrt(square).to_string()));
+        assert_that(false, is_equal(math::is_square(square)));
+
+        assert_that(std::string("31622"), is_equal(math::isqrt(math::big_integer(1000000000)).to_string()));
+        assert_that(true, is_equal(math::isqrt(math::big_integer(0)).to_string().empty()));
+
+        // r^2 <= value < (r + 1)^2 for values of different sizes
+        auto mismatches = 0;
+        auto value = math::detail::decimal_limbs::limbs_type(1, 1);
+        for (auto step = 0; step < 120; ++step) {
+            value = math::detail::decimal_limbs::add(math::detail::decimal_limbs::multiply(value, {999999937}),
+                                                     {static_cast<uint32_t>(step)});
+            const auto result = math::detail::decimal_limbs::from_big_integer(
+                math::isqrt(math::detail::decimal_limbs::to_big_integer(value)));
+            const auto next = math::detail::decimal_limbs::add(result, {1});
+            if (math::detail::decimal_limbs::compare(math::detail::decimal_limbs::multiply(result, result), value) > 0
+                || math::detail::decimal_limbs::compare(
+                       math::detail::decimal_limbs::multiply(next, next), value) <= 0) {
+                ++mismatches;
+            }
+        }
+        assert_that(0, is_equal(mismatches));
+    });
+});
@@ -0,0 +1,126 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_mapped_sieve.cxx
+/// @brief   testing of @ref math::prime::mapped_sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/mapped_sieve.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <math/prime/is_prime.h>
+#include <types/bitset.h>
+
+#include <fstream>
+#include <vector>
+#include <cstdio>
+
+using namespace unittest;
+using namespace matcher;
+
+using mapped_sieve_type = math::prime::mapped_sieve<types::bitset<uint64_t>>;
+
+/// testing of class @ref math::prime::mapped_sieve
+describe_suite("testing math::prime::mapped_sieve", [](){
+    describe_test("testing written and mapped sieve (compared with is_prime)", []() {
+        const std::string filename = "test_mapped_sieve_5000.sieve";
+        constexpr auto max_number = 5001;
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(max_number);
+        sieve.calculate();
+        mapped_sieve_type::write(filename, sieve);
+
+        {
+            const mapped_sieve_type mapped(filename);
+            assert_that(uint64_t(max_number), is_equal(mapped.max_number()));
+
+            for (auto number = 0; number <= max_number + 10; ++number) {
+                assert_that(number <= max_number && math::prime::is_prime(number),
+                            is_equal(mapped.is_prime(number)));
+            }
+
+            const std::vector<uint64_t> primes_a(sieve.begin(), sieve.end());
+            const std::vector<uint64_t> primes_b(mapped.begin(), mapped.end());
+            assert_that(primes_a, is_equal(primes_b));
+        }
+
+        std::remove(filename.c_str());
+    });
+
+    describe_test("testing for_each_prime", []() {
+        const std::string filename = "test_mapped_sieve_100.sieve";
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(100);
+        sieve.calculate();
+        mapped_sieve_type::write(filename, sieve);
+
+        {
+            const mapped_sieve_type mapped(filename);
+            std::vector<uint64_t> primes;
+            mapped.for_each_prime(80, 1000, [&primes](const uint64_t prime) {primes.push_back(prime);});
+            assert_that(std::vector<uint64_t>({83, 89, 97}), is_equal(primes));
+        }
+
+        std::remove(filename.c_str());
+    });
+
+    describe_test("testing replacing an existing sieve file", []() {
+        const std::string filename = "test_mapped_sieve_replaced.sieve";
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> small_sieve(100);
+        small_sieve.calculate();
+        mapped_sieve_type::write(filename, small_sieve);
+
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(1000);
+        sieve.calculate();
+        mapped_sieve_type::write(filename, sieve);
+
+        {
+            const mapped_sieve_type mapped(filename);
+            assert_that(uint64_t(1000), is_equal(mapped.max_number()));
+            assert_that(true, is_equal(mapped.is_prime(997)));
+        }
+
+        std::remove(filename.c_str());
+    });
+
+    describe_test("testing failing rename (no temporary file left)", []() {
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(100);
+        sieve.calculate();
+        // the current directory cannot be replaced by the written file "..tmp"
+        assert_raise<std::runtime_error>("rename", [&sieve]() {
+            mapped_sieve_type::write(".", sieve);
+        });
+        assert_that(false, is_equal(std::ifstream("..tmp").good()));
+    });
+
+    describe_test("testing missing file and wrong format", []() {
+        assert_raise<std::runtime_error>("missing file", []() {
+            const mapped_sieve_type mapped("test_mapped_sieve_missing.sieve");
+        });
+
+        const std::string filename = "test_mapped_sieve_wrong.sieve";
+        {
+            std::ofstream stream(filename, std::ios::binary);
+            stream << "this is not a sieve file but it is long enough for a header";
+        }
+
+        assert_raise<std::runtime_error>("wrong format", [&filename]() {
+            const mapped_sieve_type mapped(filename);
+        });
+
+        std::remove(filename.c_str());
+    });
+});
@@ -0,0 +1,70 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_miller_rabin.cxx
+/// @brief   testing of @ref math::prime::miller_rabin
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/miller_rabin.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <types/bitset.h>
+
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+using math::prime::miller_rabin;
+
+/// testing of class @ref math::prime::miller_rabin
+describe_suite("testing math::prime::miller_rabin", [](){
+    describe_test("testing montgomery arithmetic", []() {
+        const math::prime::montgomery_u64 arithmetic(1000000007);
+        const auto a = arithmetic.to_montgomery(123456789);
+        const auto b = arithmetic.to_montgomery(987654321);
+        assert_that(uint64_t(123456789) * 987654321 % 1000000007,
+                    is_equal(arithmetic.from_montgomery(arithmetic.multiply(a, b))));
+        assert_that(uint64_t(1), is_equal(arithmetic.from_montgomery(arithmetic.one())));
+        assert_that(uint64_t(1024), is_equal(arithmetic.from_montgomery(
+            arithmetic.power(arithmetic.to_montgomery(2), 10))));
+    });
+
+    describe_test("testing small numbers", []() {
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(200000);
+        sieve.calculate();
+        for (auto number = uint64_t(0); number <= 200000; ++number) {
+            assert_that(sieve.is_prime(number), is_equal(miller_rabin::is_prime(number)));
+        }
+    });
+
+    describe_test("testing big numbers", []() {
+        // strong pseudoprimes to the first prime bases
+        for (const auto number: {3215031751ULL, 2152302898747ULL, 3474749660383ULL,
+                                 341550071728321ULL, 3825123056546413051ULL}) {
+            assert_that(false, is_equal(miller_rabin::is_prime(number)));
+        }
+
+        // 2^61 - 1, biggest prime below 2^64 and 2^64 - 1
+        assert_that(true, is_equal(miller_rabin::is_prime(2305843009213693951ULL)));
+        assert_that(true, is_equal(miller_rabin::is_prime(18446744073709551557ULL)));
+        assert_that(false, is_equal(miller_rabin::is_prime(18446744073709551615ULL)));
+        // (2^32 - 5) * (2^32 - 17)
+        assert_that(false, is_equal(miller_rabin::is_prime(18446743979220271189ULL)));
+    });
+});
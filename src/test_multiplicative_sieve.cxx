@@ -0,0 +1,92 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_multiplicative_sieve.cxx
+/// @brief   testing of @ref math::prime::multiplicative_sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/multiplicative_sieve.h>
+#include <math/factorization.h>
+#include <generator/select.h>
+
+#include <stdexcept>
+#include <vector>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+using math::prime::multiplicative_sieve;
+
+/// testing of class @ref math::prime::multiplicative_sieve
+describe_suite("testing math::prime::multiplicative_sieve", [](){
+    describe_test("testing all outputs", []() {
+        multiplicative_sieve sieve(20000);
+        sieve.calculate();
+
+        math::factorization<uint32_t>::factors_type factors;
+        for (auto number = uint32_t(1); number <= sieve.max_number(); ++number) {
+            math::factorization<uint32_t>::prime_factors(number, factors);
+
+            auto phi = number;
+            auto mu = 1;
+            for (const auto& factor: factors) {
+                phi = phi / factor.first * (factor.first - 1);
+                mu = factor.second > 1? 0: -mu;
+            }
+
+            assert_that(phi, is_equal(sieve.phi(number)));
+            assert_that(mu, is_equal(sieve.mu(number)));
+            assert_that(uint32_t(factors.size()), is_equal(sieve.omega(number)));
+        }
+    });
+
+    describe_test("testing selected outputs", []() {
+        multiplicative_sieve sieve(100, multiplicative_sieve::MU);
+        sieve.calculate();
+
+        assert_that(-1, is_equal(sieve.mu(30)));
+        assert_that(0, is_equal(sieve.mu(12)));
+        assert_raise<std::runtime_error>("output of multiplicative sieve has not been selected",
+                                         [&sieve]() { sieve.phi(10); });
+        assert_raise<std::runtime_error>("output of multiplicative sieve has not been selected",
+                                         [&sieve]() { sieve.omega(10); });
+
+        multiplicative_sieve tiny(1, multiplicative_sieve::PHI);
+        tiny.calculate();
+        assert_that(uint32_t(1), is_equal(tiny.phi(1)));
+    });
+
+    describe_test("testing filters of generator::select", []() {
+        multiplicative_sieve sieve(1000, multiplicative_sieve::PHI | multiplicative_sieve::MU);
+        sieve.calculate();
+
+        // 608 squarefree numbers up to 1000
+        const auto squarefree = generator::select(uint32_t(1), uint32_t(1000), uint32_t(1))
+            .where([&sieve](const uint32_t number) { return sieve.mu(number) != 0; })
+            .to_vector();
+        assert_that(std::size_t(608), is_equal(squarefree.size()));
+
+        // phi(n) = n - 1 for primes only
+        const auto primes = generator::select(uint32_t(2), uint32_t(30), uint32_t(1))
+            .where([&sieve](const uint32_t number) { return sieve.phi(number) == number - 1; })
+            .to_vector();
+        assert_that(std::vector<uint32_t>({2, 3, 5, 7, 11, 13, 17, 19, 23, 29}), is_equal(primes));
+    });
+});
@@ -23,6 +23,8 @@
 #include <unittest/unittest.h>
 #include <math/number.h>
 #include <generator/select.h>
+#include <vector>
+#include <cstdint>
 
 using namespace unittest;
 using namespace matcher;
@@ -51,6 +53,54 @@ describe_suite("testing math::number", [](){
         assert_that(some_abundant_numbers, is_equal(results));
     });
 
+    describe_test("testing is_deficient", []() {
+        const std::vector<int> some_deficient_numbers = {1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 13, 14, 15, 16, 17, 19};
+        auto results = generator::select(1, 20, 1)
+            .where([](int number){return math::number<int>::is_deficient(number);})
+            .to_vector();
+
+        assert_that(some_deficient_numbers, is_equal(results));
+    });
+
+    describe_test("testing range versions with divisor sum sieve", []() {
+        math::divisor_sum_sieve<uint32_t> sieve(10000);
+        sieve.calculate();
+
+        std::vector<bool> perfect;
+        std::vector<bool> abundant;
+        std::vector<bool> deficient;
+        math::number<int>::is_perfect(sieve, 1, 10000, perfect);
+        math::number<int>::is_abundant(sieve, 1, 10000, abundant);
+        math::number<int>::is_deficient(sieve, 1, 10000, deficient);
+
+        assert_that(std::size_t(10000), is_equal(perfect.size()));
+        for (auto number = 1; number <= 10000; ++number) {
+            const auto index = static_cast<std::size_t>(number - 1);
+            assert_that(math::number<int>::is_perfect(number), is_equal(bool(perfect[index])));
+            assert_that(math::number<int>::is_abundant(number), is_equal(bool(abundant[index])));
+            assert_that(math::number<int>::is_deficient(number), is_equal(bool(deficient[index])));
+        }
+
+        math::number<int>::is_perfect(sieve, 490, 500, perfect);
+        assert_that(std::vector<bool>({false, false, false, false, false, false, true, false, false, false, false}),
+                    is_equal(perfect));
+
+        // the "divisors" 1 and 0 of 0 sum up to 1: 0 is abundant (as before the sum of divisors)
+        math::number<int>::is_perfect(sieve, 0, 0, perfect);
+        math::number<int>::is_abundant(sieve, 0, 0, abundant);
+        math::number<int>::is_deficient(sieve, 0, 0, deficient);
+        assert_that(std::vector<bool>({false}), is_equal(perfect));
+        assert_that(std::vector<bool>({true}), is_equal(abundant));
+        assert_that(std::vector<bool>({false}), is_equal(deficient));
+        assert_that(false, is_equal(math::number<int>::is_perfect(0)));
+        assert_that(true, is_equal(math::number<int>::is_abundant(0)));
+        assert_that(false, is_equal(math::number<int>::is_deficient(0)));
+
+        // the range may end with the biggest value of the type
+        math::number<uint8_t>::is_abundant(sieve, 250, 255, abundant);
+        assert_that(std::vector<bool>({false, false, true, false, false, false}), is_equal(abundant));
+    });
+
     describe_test("testing is_square", []() {
         // positiv check (probe):
         assert_that(true, is_equal(math::number<int>::is_square(1)));
@@ -135,6 +185,55 @@ describe_suite("testing math::number", [](){
         assert_that(true, is_not(is_equal(math::number<int>::is_hexagonal(200))));
     });
 
+    describe_test("testing figurate numbers above 2^53", []() {
+        using number_u64 = math::number<uint64_t>;
+        // 2^54 + 1 is 2^54 as double
+        assert_that(false, is_equal(number_u64::is_square(18014398509481985ULL)));
+        assert_that(true, is_equal(number_u64::is_square(18014398509481984ULL)));
+
+        // 8 * n + 1 and 24 * n + 1 do not fit into 64 bit
+        assert_that(true, is_equal(number_u64::is_triangle(18446744070963499500ULL)));
+        assert_that(false, is_equal(number_u64::is_triangle(18446744070963499501ULL)));
+        assert_that(true, is_equal(number_u64::is_pentagonal(18446744067954141760ULL)));
+        assert_that(false, is_equal(number_u64::is_pentagonal(18446744067954141759ULL)));
+        assert_that(true, is_equal(number_u64::is_hexagonal(18446744058815497503ULL)));
+        assert_that(false, is_equal(number_u64::is_hexagonal(18446744058815497505ULL)));
+        assert_that(false, is_equal(math::number<int>::is_triangle(-1)));
+    });
+
+    describe_test("testing batch versions of figurate numbers", []() {
+        const auto count = std::size_t(100000);
+        std::vector<uint64_t> numbers(count);
+        for (auto index = std::size_t(0); index < count; ++index) {
+            numbers[index] = index;
+        }
+
+        // marking the figurate numbers below count by their formulas
+        std::vector<uint8_t> squares(count, 0), triangles(count, 0), pentagonals(count, 0), hexagonals(count, 0);
+        for (auto nth = uint64_t(0); nth * nth < count; ++nth) {
+            squares[nth * nth] = 1;
+        }
+        for (auto nth = uint64_t(0); math::number<uint64_t>::triangle(nth) < count; ++nth) {
+            triangles[math::number<uint64_t>::triangle(nth)] = 1;
+        }
+        for (auto nth = uint64_t(1); math::number<uint64_t>::pentagonal(nth) < count; ++nth) {
+            pentagonals[math::number<uint64_t>::pentagonal(nth)] = 1;
+        }
+        for (auto nth = uint64_t(1); math::number<uint64_t>::hexagonal(nth) < count; ++nth) {
+            hexagonals[math::number<uint64_t>::hexagonal(nth)] = 1;
+        }
+
+        std::vector<uint8_t> results(count, 2);
+        math::number<uint64_t>::is_square_batch(numbers.data(), count, results.data());
+        assert_that(true, is_equal(squares == results));
+        math::number<uint64_t>::is_triangle_batch(numbers.data(), count, results.data());
+        assert_that(true, is_equal(triangles == results));
+        math::number<uint64_t>::is_pentagonal_batch(numbers.data(), count, results.data());
+        assert_that(true, is_equal(pentagonals == results));
+        math::number<uint64_t>::is_hexagonal_batch(numbers.data(), count, results.data());
+        assert_that(true, is_equal(hexagonals == results));
+    });
+
     describe_test("testing is_pandigital", []() {
         // positive check
         assert_that(true, is_equal(math::number<int>::is_pandigital(123456789)));
@@ -23,6 +23,8 @@
 #include <unittest/unittest.h>
 #include <math/power_of_two.h>
 
+#include <algorithm>
+#include <string>
 #include <vector>
 #include <sstream>
 #include <cstdint>
@@ -59,5 +61,33 @@ describe_suite("testing math::power_of_two", [](){
 
         assert_that(expected, is_equal(given.str()));
     });
+
+    describe_test("testing incremental and memoised calculations", []() {
+        // same value regardless of the path (doubling, halving or squares)
+        math::power_of_two reference;
+        math::power_of_two pot;
+        for (const auto exponent: {5000u, 5001u, 4000u, 100u, 20000u, 3u, 20000u, 70000u}) {
+            reference.calculate(0);
+            for (auto step = 0u; step < exponent; step += 1000) {
+                reference.calculate(std::min(exponent, step + 1000));
+            }
+            pot.calculate(exponent);
+            assert_that(exponent, is_equal(pot.exponent()));
+
+            std::stringstream expected;
+            expected << reference;
+            std::stringstream given;
+            given << pot;
+            assert_that(expected.str(), is_equal(given.str()));
+        }
+
+        // 2^100000 has 30103 digits
+        pot.calculate(100000);
+        std::stringstream given;
+        given << pot;
+        assert_that(std::size_t(30103), is_equal(given.str().size()));
+        assert_that(std::string("999002093014384507944032764330033590980429139054181691771529"),
+                    is_equal(given.str().substr(0, 60)));
+    });
 });
 
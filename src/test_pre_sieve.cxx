@@ -0,0 +1,101 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_pre_sieve.cxx
+/// @brief   testing of @ref math::prime::pre_sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/pre_sieve.h>
+#include <types/bitset.h>
+
+#include <vector>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return expected states for the numbers first + step * j
+static std::vector<bool> expected_states(const uint64_t number_of_bits, const uint64_t first, const uint64_t step) {
+    std::vector<bool> states;
+    for (auto bit = uint64_t(0); bit < number_of_bits; ++bit) {
+        const auto number = first + step * bit;
+        auto state = true;
+        for (const auto prime: {uint64_t(2), uint64_t(3), uint64_t(5), uint64_t(7),
+                                uint64_t(11), uint64_t(13), uint64_t(17), uint64_t(19)}) {
+            if (number % prime == 0 && number != prime) {
+                state = false;
+            }
+        }
+        states.push_back(state);
+    }
+    return states;
+}
+
+/// @return states of given words
+static std::vector<bool> to_states(const std::vector<uint64_t>& words, const uint64_t number_of_bits) {
+    std::vector<bool> states;
+    for (auto bit = uint64_t(0); bit < number_of_bits; ++bit) {
+        states.push_back(((words[bit / 64] >> (bit % 64)) & 1) == 1);
+    }
+    return states;
+}
+
+/// testing of class @ref math::prime::pre_sieve
+describe_suite("testing math::prime::pre_sieve", [](){
+    describe_test("testing words with odd numbers only", []() {
+        for (const auto first: {uint64_t(1), uint64_t(3), uint64_t(21), uint64_t(4849845), uint64_t(1000000000001)}) {
+            for (const auto number_of_bits: {uint64_t(1), uint64_t(63), uint64_t(64), uint64_t(200), uint64_t(40000)}) {
+                std::vector<uint64_t> words(number_of_bits / 64 + 1, ~uint64_t(0));
+                math::prime::pre_sieve::apply(words.data(), number_of_bits, first, 2);
+                assert_that(expected_states(number_of_bits, first, 2), is_equal(to_states(words, number_of_bits)));
+                // bits behind the last one are cleared
+                const auto last_word = words[(number_of_bits - 1) / 64];
+                assert_that(uint64_t(0), is_equal((number_of_bits % 64 == 0)? 0: last_word >> (number_of_bits % 64)));
+            }
+        }
+    });
+
+    describe_test("testing words with all numbers", []() {
+        for (const auto first: {uint64_t(0), uint64_t(2), uint64_t(19), uint64_t(1000000000000)}) {
+            std::vector<uint64_t> words(40000 / 64 + 1, 0);
+            math::prime::pre_sieve::apply(words.data(), 40000, first, 1);
+            assert_that(expected_states(40000, first, 1), is_equal(to_states(words, 40000)));
+        }
+    });
+
+    describe_test("testing containers", []() {
+        std::vector<bool> states_a(1000, false);
+        types::bitset<uint64_t> states_b(1000);
+        types::bitset<unsigned char> states_c(1000);
+        math::prime::pre_sieve::apply(states_a, 1000, 0, 1);
+        math::prime::pre_sieve::apply(states_b, 1000, 0, 1);
+        math::prime::pre_sieve::apply(states_c, 1000, 0, 1);
+
+        const auto expected = expected_states(1000, 0, 1);
+        assert_that(expected, is_equal(states_a));
+        for (auto bit = 0; bit < 1000; ++bit) {
+            assert_that(bool(expected[bit]), is_equal(bool(states_b[bit])));
+            assert_that(bool(expected[bit]), is_equal(bool(states_c[bit])));
+        }
+
+        std::vector<bool> odd_states(500, false);
+        math::prime::pre_sieve::apply(odd_states, 500, 1, 2);
+        assert_that(expected_states(500, 1, 2), is_equal(odd_states));
+    });
+});
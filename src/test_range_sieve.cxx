@@ -0,0 +1,97 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_range_sieve.cxx
+/// @brief   testing of @ref math::prime::range_sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/range_sieve.h>
+#include <math/prime/is_prime.h>
+#include <math/prime/sieve_interface.h>
+#include <generator/select.h>
+#include <types/bitset.h>
+
+#include <memory>
+#include <vector>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return primes in [min_number, max_number] (using trial division)
+static std::vector<uint64_t> expected_primes(const uint64_t min_number, const uint64_t max_number) {
+    return generator::select(min_number, max_number, uint64_t(1))
+        .where([](const uint64_t number) {return math::prime::is_prime(number);})
+        .to_vector();
+}
+
+/// testing of class @ref math::prime::range_sieve
+describe_suite("testing math::prime::range_sieve", [](){
+    describe_test("testing different windows (compared with is_prime)", []() {
+        for (auto min_number = uint64_t(0); min_number <= 40; ++min_number) {
+            for (auto max_number = min_number; max_number <= min_number + 150; max_number += 13) {
+                math::prime::range_sieve<types::bitset<uint64_t>> sieve(min_number, max_number);
+                sieve.calculate();
+                const std::vector<uint64_t> primes(sieve.begin(), sieve.end());
+                assert_that(expected_primes(min_number, max_number), is_equal(primes));
+            }
+        }
+    });
+
+    describe_test("testing is_prime outside of the window", []() {
+        math::prime::range_sieve<std::vector<bool>> sieve(100, 200);
+        sieve.calculate();
+
+        assert_that(false, is_equal(sieve.is_prime(2)));
+        assert_that(false, is_equal(sieve.is_prime(97)));
+        assert_that(true, is_equal(sieve.is_prime(101)));
+        assert_that(true, is_equal(sieve.is_prime(199)));
+        assert_that(false, is_equal(sieve.is_prime(211)));
+        assert_that(uint64_t(100), is_equal(sieve.min_number()));
+        assert_that(uint64_t(200), is_equal(sieve.max_number()));
+        assert_that(uint64_t(201), is_equal(sieve.next_prime(200)));
+    });
+
+    describe_test("testing empty window", []() {
+        math::prime::range_sieve<types::bitset<uint64_t>> sieve(200, 100);
+        sieve.calculate();
+        assert_that(true, is_equal(sieve.begin() == sieve.end()));
+        assert_that(false, is_equal(sieve.is_prime(149)));
+    });
+
+    describe_test("testing window far above zero", []() {
+        constexpr auto min_number = uint64_t(1000000000000000);
+        math::prime::range_sieve<types::bitset<uint64_t>> sieve(min_number, min_number + 200);
+        sieve.calculate();
+
+        std::vector<uint64_t> primes;
+        sieve.for_each_prime(0, min_number + 1000, [&primes](const uint64_t prime) {primes.push_back(prime);});
+        assert_that(std::vector<uint64_t>({min_number + 37, min_number + 91, min_number + 159, min_number + 187}),
+                    is_equal(primes));
+    });
+
+    describe_test("testing via sieve interface", []() {
+        std::unique_ptr<math::prime::sieve_interface<types::bitset<uint64_t>>> sieve(
+            new math::prime::range_sieve<types::bitset<uint64_t>>(1000, 1100));
+        sieve->calculate();
+
+        std::vector<uint64_t> primes;
+        sieve->for_each_prime(0, 1100, [&primes](const uint64_t prime) {primes.push_back(prime);});
+        assert_that(expected_primes(1000, 1100), is_equal(primes));
+    });
+});
@@ -0,0 +1,118 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_sieve_facade.cxx
+/// @brief   testing of @ref math::prime::sieve_facade
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/sieve_of_eratosthenes.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <math/prime/extendable_sieve.h>
+#include <math/prime/mapped_sieve.h>
+#include <math/prime/is_prime.h>
+#include <types/bitset.h>
+
+#include <random>
+#include <vector>
+#include <cstdio>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return random candidates (also behind the limit) including the special ones 0, 1 and 2
+static std::vector<uint64_t> create_candidates(const uint64_t max_number) {
+    std::mt19937_64 generator(12345);
+    std::uniform_int_distribution<uint64_t> distribution(0, max_number + 100);
+    std::vector<uint64_t> candidates = {0, 1, 2, 3, 4, max_number, max_number + 1, max_number + 2};
+    for (auto count = 0; count < 1000; ++count) {
+        candidates.push_back(distribution(generator));
+    }
+    return candidates;
+}
+
+/// @return expected results for the candidates (using trial division)
+static std::vector<uint8_t> expected_results(const std::vector<uint64_t>& candidates, const uint64_t max_number) {
+    std::vector<uint8_t> results;
+    for (const auto candidate: candidates) {
+        results.push_back(candidate <= max_number && math::prime::is_prime(candidate));
+    }
+    return results;
+}
+
+/// @return results of batch check of given sieve
+template <typename S>
+static std::vector<uint8_t> batch_results(const S& sieve, const std::vector<uint64_t>& candidates) {
+    std::vector<uint8_t> results(candidates.size(), 2);
+    sieve.is_prime_batch(candidates.data(), candidates.size(), results.data());
+    return results;
+}
+
+/// testing of class @ref math::prime::sieve_facade
+describe_suite("testing math::prime::sieve_facade", [](){
+    constexpr auto max_number = uint64_t(10001);
+    const auto candidates = create_candidates(max_number);
+    const auto expected = expected_results(candidates, max_number);
+
+    describe_test("testing is_prime_batch (sieve_of_eratosthenes)", [candidates, expected]() {
+        math::prime::sieve_of_eratosthenes<std::vector<bool>> sieve_a(max_number);
+        math::prime::sieve_of_eratosthenes<types::bitset<uint64_t>> sieve_b(max_number);
+        sieve_a.calculate();
+        sieve_b.calculate();
+        assert_that(expected, is_equal(batch_results(sieve_a, candidates)));
+        assert_that(expected, is_equal(batch_results(sieve_b, candidates)));
+    });
+
+    describe_test("testing is_prime_batch (sieve_of_eratosthenes_optimized)", [candidates, expected]() {
+        math::prime::sieve_of_eratosthenes_optimized<std::vector<bool>> sieve_a(max_number);
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve_b(max_number);
+        sieve_a.calculate();
+        sieve_b.calculate();
+        assert_that(expected, is_equal(batch_results(sieve_a, candidates)));
+        assert_that(expected, is_equal(batch_results(sieve_b, candidates)));
+    });
+
+    describe_test("testing is_prime_batch (extendable_sieve)", [candidates, expected]() {
+        math::prime::extendable_sieve<types::bitset<uint32_t>> sieve(max_number / 3);
+        sieve.calculate();
+        sieve.extend_to(max_number);
+        assert_that(expected, is_equal(batch_results(sieve, candidates)));
+    });
+
+    describe_test("testing is_prime_batch (mapped_sieve)", [candidates, expected]() {
+        const std::string filename = "test_sieve_facade.sieve";
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(max_number);
+        sieve.calculate();
+        math::prime::mapped_sieve<types::bitset<uint64_t>>::write(filename, sieve);
+        {
+            const math::prime::mapped_sieve<types::bitset<uint64_t>> mapped(filename);
+            assert_that(expected, is_equal(batch_results(mapped, candidates)));
+        }
+        std::remove(filename.c_str());
+    });
+
+    describe_test("testing lookup (small limits)", []() {
+        for (auto limit = uint64_t(0); limit <= 3; ++limit) {
+            math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(limit);
+            sieve.calculate();
+            assert_that(limit >= 2, is_equal(sieve.lookup(2)));
+            assert_that(limit >= 3, is_equal(sieve.lookup(3)));
+            assert_that(false, is_equal(sieve.lookup(1)));
+        }
+    });
+});
@@ -24,8 +24,10 @@
 #include <math/prime/sieve_of_eratosthenes.h>
 #include <math/prime/is_prime.h>
 #include <generator/select.h>
+#include <types/bitset.h>
 
 #include <vector>
+#include <memory>
 
 using namespace unittest;
 using namespace matcher;
@@ -69,5 +71,61 @@ describe_suite("testing math::prime::sieve_of_eratosthenes", [](){
         const std::vector<int> expected = {2, 3, 5, 7, 11, 13, 17, 19, 23};
         assert_that(expected, is_equal(primes));
     });
+
+    describe_test("testing prime iterator (bitset, compared with is_prime)", []() {
+        constexpr auto max_number = 5000;
+        math::prime::sieve_of_eratosthenes<types::bitset<uint64_t>> sieve(max_number);
+        sieve.calculate();
+
+        std::vector<uint64_t> primes;
+        for (const auto prime: sieve) {
+            primes.push_back(prime);
+        }
+
+        const auto expected = generator::select(uint64_t(0), uint64_t(max_number), uint64_t(1))
+            .where([](const uint64_t number) {return math::prime::is_prime(number);})
+            .to_vector();
+        assert_that(expected, is_equal(primes));
+    });
+
+    describe_test("testing for_each_prime (vector<bool> and bitset)", []() {
+        constexpr auto max_number = 1000;
+        math::prime::sieve_of_eratosthenes<std::vector<bool>> sieve_a(max_number);
+        math::prime::sieve_of_eratosthenes<types::bitset<uint64_t>> sieve_b(max_number);
+        sieve_a.calculate();
+        sieve_b.calculate();
+
+        std::vector<uint64_t> primes_a;
+        std::vector<uint64_t> primes_b;
+        sieve_a.for_each_prime(100, 200, [&primes_a](const uint64_t prime) {primes_a.push_back(prime);});
+        sieve_b.for_each_prime(100, 200, [&primes_b](const uint64_t prime) {primes_b.push_back(prime);});
+
+        const std::vector<uint64_t> expected = {
+            101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151,
+            157, 163, 167, 173, 179, 181, 191, 193, 197, 199};
+        assert_that(expected, is_equal(primes_a));
+        assert_that(expected, is_equal(primes_b));
+    });
+
+    describe_test("testing next_prime at the limits", []() {
+        math::prime::sieve_of_eratosthenes<types::bitset<uint64_t>> sieve(100);
+        sieve.calculate();
+
+        assert_that(uint64_t(100), is_equal(sieve.max_number()));
+        assert_that(uint64_t(2), is_equal(sieve.next_prime(0)));
+        assert_that(uint64_t(97), is_equal(sieve.next_prime(90)));
+        assert_that(uint64_t(101), is_equal(sieve.next_prime(98)));
+        assert_that(uint64_t(101), is_equal(sieve.next_prime(1000)));
+    });
+
+    describe_test("testing for_each_prime via sieve_interface", []() {
+        std::unique_ptr<math::prime::sieve_interface<types::bitset<uint64_t>>> sieve(
+            new math::prime::sieve_of_eratosthenes<types::bitset<uint64_t>>(30));
+        sieve->calculate();
+
+        std::vector<uint64_t> primes(sieve->begin(), sieve->end());
+        const std::vector<uint64_t> expected = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29};
+        assert_that(expected, is_equal(primes));
+    });
 });
 
@@ -0,0 +1,87 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_sieve_of_eratosthenes_optimized.cxx
+/// @brief   testing of @ref math::primes::sieve_of_eratosthenes_optimized
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/sieve_of_eratosthenes_optimized.h>
+#include <math/prime/is_prime.h>
+#include <generator/select.h>
+#include <types/bitset.h>
+
+#include <vector>
+
+using namespace unittest;
+using namespace matcher;
+
+/// testing of class @ref math::primes::sieve_of_eratosthenes_optimized
+describe_suite("testing math::prime::sieve_of_eratosthenes_optimized", [](){
+    describe_test("testing sieve 5000 (compared with is_prime)", []() {
+        constexpr auto max_number = 5000;
+        math::prime::sieve_of_eratosthenes_optimized<std::vector<bool>> sieve(max_number);
+        sieve.calculate();
+
+        for (auto number = 0; number <= max_number; ++number) {
+            assert_that(math::prime::is_prime(number), is_equal(sieve.is_prime(number)));
+        }
+    });
+
+    describe_test("testing odd limits (compared with is_prime)", []() {
+        for (auto max_number = 0; max_number <= 50; ++max_number) {
+            math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(max_number);
+            sieve.calculate();
+
+            std::vector<uint64_t> primes(sieve.begin(), sieve.end());
+            const auto expected = generator::select(uint64_t(0), uint64_t(max_number), uint64_t(1))
+                .where([](const uint64_t number) {return math::prime::is_prime(number);})
+                .to_vector();
+            assert_that(expected, is_equal(primes));
+        }
+    });
+
+    describe_test("testing prime iterator (bitset, compared with is_prime)", []() {
+        constexpr auto max_number = 5000;
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(max_number);
+        sieve.calculate();
+
+        std::vector<uint64_t> primes;
+        for (const auto prime: sieve) {
+            primes.push_back(prime);
+        }
+
+        const auto expected = generator::select(uint64_t(0), uint64_t(max_number), uint64_t(1))
+            .where([](const uint64_t number) {return math::prime::is_prime(number);})
+            .to_vector();
+        assert_that(expected, is_equal(primes));
+    });
+
+    describe_test("testing for_each_prime", []() {
+        math::prime::sieve_of_eratosthenes_optimized<types::bitset<uint64_t>> sieve(1000);
+        sieve.calculate();
+
+        std::vector<uint64_t> primes;
+        sieve.for_each_prime(2, 20, [&primes](const uint64_t prime) {primes.push_back(prime);});
+        assert_that(std::vector<uint64_t>({2, 3, 5, 7, 11, 13, 17, 19}), is_equal(primes));
+
+        primes.clear();
+        sieve.for_each_prime(990, 5000, [&primes](const uint64_t prime) {primes.push_back(prime);});
+        assert_that(std::vector<uint64_t>({991, 997}), is_equal(primes));
+    });
+});
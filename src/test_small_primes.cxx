@@ -0,0 +1,76 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_small_primes.cxx
+/// @brief   testing of @ref math::prime::small_primes_table
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/small_primes.h>
+#include <math/prime/sieve_of_eratosthenes.h>
+#include <types/bitset.h>
+
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+using math::prime::small_primes;
+
+static_assert(!small_primes::is_prime(0) && !small_primes::is_prime(1), "0 and 1 are not prime");
+static_assert(small_primes::is_prime(2) && small_primes::is_prime(3), "2 and 3 are prime");
+static_assert(!small_primes::is_prime(65535) && small_primes::is_prime(65521), "largest prime below 2^16");
+static_assert(small_primes::primes[0] == 2 && small_primes::primes[small_primes::COUNT - 1] == 65521,
+              "first and last prime of the list");
+static_assert(small_primes::count_primes(100) == 25, "25 primes up to 100");
+
+/// the sieve the tables are compared with
+using reference_sieve = math::prime::sieve_of_eratosthenes<types::bitset<uint64_t>>;
+
+/// testing of class @ref math::prime::small_primes_table
+describe_suite("testing math::prime::small_primes_table", [](){
+    describe_test("testing primality bitmap", []() {
+        auto reference = reference_sieve(small_primes::LIMIT - 1);
+        reference.calculate();
+        for (auto number = uint32_t(0); number < small_primes::LIMIT; ++number) {
+            assert_that(reference.is_prime(number), is_equal(small_primes::is_prime(number)));
+        }
+    });
+
+    describe_test("testing list of primes", []() {
+        auto reference = reference_sieve(small_primes::LIMIT - 1);
+        reference.calculate();
+        auto nth = std::size_t(0);
+        for (auto number = uint32_t(0); number < small_primes::LIMIT; ++number) {
+            if (reference.is_prime(number)) {
+                assert_that(number, is_equal(uint32_t(small_primes::primes[nth++])));
+            }
+        }
+        assert_that(std::size_t(small_primes::COUNT), is_equal(nth));
+    });
+
+    describe_test("testing counting primes", []() {
+        auto reference = reference_sieve(small_primes::LIMIT - 1);
+        reference.calculate();
+        auto count = uint32_t(0);
+        for (auto number = uint32_t(0); number < small_primes::LIMIT; ++number) {
+            count += reference.is_prime(number)? 1: 0;
+            assert_that(count, is_equal(small_primes::count_primes(number)));
+        }
+    });
+});
@@ -0,0 +1,102 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_smallest_prime_factor_sieve.cxx
+/// @brief   testing of @ref math::prime::smallest_prime_factor_sieve
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/prime/smallest_prime_factor_sieve.h>
+#include <math/factorization.h>
+
+#include <stdexcept>
+#include <vector>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+using math::prime::smallest_prime_factor_sieve;
+
+/// testing of class @ref math::prime::smallest_prime_factor_sieve
+describe_suite("testing math::prime::smallest_prime_factor_sieve", [](){
+    describe_test("testing smallest prime factor", []() {
+        smallest_prime_factor_sieve sieve(20000);
+        sieve.calculate();
+
+        for (auto number = uint32_t(2); number <= sieve.max_number(); ++number) {
+            auto expected = uint32_t(2);
+            while (number % expected != 0) {
+                ++expected;
+            }
+            assert_that(expected, is_equal(sieve.smallest_prime_factor(number)));
+        }
+    });
+
+    describe_test("testing factorize", []() {
+        smallest_prime_factor_sieve sieve(1000000);
+        sieve.calculate();
+
+        smallest_prime_factor_sieve::factors_type factors;
+        sieve.factorize(360, factors);
+        assert_that(std::size_t(3), is_equal(factors.size()));
+        assert_that(true, is_equal(factors[0] == std::make_pair(uint32_t(2), uint32_t(3))));
+        assert_that(true, is_equal(factors[1] == std::make_pair(uint32_t(3), uint32_t(2))));
+        assert_that(true, is_equal(factors[2] == std::make_pair(uint32_t(5), uint32_t(1))));
+
+        sieve.factorize(1, factors);
+        assert_that(true, is_equal(factors.empty()));
+        // 999983 is a prime, 994009 = 997^2
+        sieve.factorize(999983, factors);
+        assert_that(true, is_equal(factors.size() == 1 && factors[0].first == 999983 && factors[0].second == 1));
+        sieve.factorize(994009, factors);
+        assert_that(true, is_equal(factors.size() == 1 && factors[0].first == 997 && factors[0].second == 2));
+
+        // product of the prime powers is the number again
+        for (auto number = uint32_t(1); number <= sieve.max_number(); number += 7) {
+            sieve.factorize(number, factors);
+            auto product = uint32_t(1);
+            for (const auto& factor: factors) {
+                for (auto nth = uint32_t(0); nth < factor.second; ++nth) {
+                    product *= factor.first;
+                }
+            }
+            assert_that(number, is_equal(product));
+        }
+
+        assert_raise<std::runtime_error>("number is behind the limit of the smallest prime factor sieve",
+                                         [&sieve, &factors]() { sieve.factorize(1000001, factors); });
+    });
+
+    describe_test("testing divisors", []() {
+        smallest_prime_factor_sieve sieve(5000);
+        sieve.calculate();
+
+        smallest_prime_factor_sieve::divisors_type divisors;
+        math::factorization<int>::container_type expected;
+        for (auto number = 1; number <= 5000; ++number) {
+            sieve.divisors(static_cast<uint32_t>(number), divisors);
+            math::factorization<int>::probe(number, expected);
+            assert_that(smallest_prime_factor_sieve::divisors_type(expected.begin(), expected.end()),
+                        is_equal(divisors));
+        }
+
+        sieve.divisors(0, divisors);
+        assert_that(true, is_equal(divisors.empty()));
+    });
+});
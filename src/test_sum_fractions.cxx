@@ -0,0 +1,110 @@
+///
+/// @author  Thomas Lehmann
+/// @file    test_sum_fractions.cxx
+/// @brief   testing of exact sum of many fractions.
+///
+/// Copyright (c) 2015 Thomas Lehmann
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+/// documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+/// and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+/// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY,
+/// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <unittest/unittest.h>
+#include <math/sum_fractions.h>
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace unittest;
+using namespace matcher;
+
+/// @return sum of the fractions adding one after the other
+template <typename T>
+static math::fraction<T> sequential_sum(const std::vector<math::fraction<T>>& terms) {
+    auto sum = math::fraction<T>(0, 1);
+    for (const auto& term: terms) {
+        sum = sum + term;
+    }
+    return sum;
+}
+
+/// testing of function @ref math::sum_fractions
+describe_suite("testing math::sum_fractions", [](){
+    describe_test("testing builtin fractions", []() {
+        std::vector<math::fraction<int64_t>> terms;
+        for (auto k = int64_t(1); k <= 40; ++k) {
+            terms.emplace_back(1, k);
+        }
+
+        const auto harmonic = math::sum_fractions(terms);
+        assert_that(int64_t(2078178381193813), is_equal(harmonic.get_numerator()));
+        assert_that(int64_t(485721041551200), is_equal(harmonic.get_denominator()));
+        assert_that(harmonic, is_equal(math::sum_fractions(terms.begin(), terms.end(), 2)));
+        assert_that(math::fraction<int64_t>(0, 1), is_equal(math::sum_fractions(terms.begin(), terms.begin())));
+
+        // the exception of the other thread is reported too
+        for (auto k = int64_t(41); k <= 100; ++k) {
+            terms.emplace_back(1, k);
+        }
+        assert_raise<std::overflow_error>("fraction does not fit into the value type", [&terms]() {
+            math::sum_fractions(terms, 2);
+        });
+    });
+
+    describe_test("testing big integer fractions", []() {
+        using big_fraction = math::fraction<math::big_integer>;
+        std::vector<big_fraction> terms;
+        for (auto k = 1; k <= 200; ++k) {
+            terms.emplace_back(1, k);
+        }
+
+        const auto harmonic = math::sum_fractions(terms);
+        assert_that(std::string("7343045013936630474541289203706909900117016127564"
+                                "0475032430988199840965762047744114895233"),
+                    is_equal(harmonic.get_numerator().to_string()));
+        assert_that(std::string("1249235514196023202368391728869782990490349565870"
+                                "9527193661000811749408076321384817296000"),
+                    is_equal(harmonic.get_denominator().to_string()));
+        assert_that(harmonic, is_equal(math::sum_fractions(terms, 0)));
+        assert_that(harmonic, is_equal(math::sum_fractions(terms, 3)));
+
+        using terms_type = std::vector<big_fraction>;
+        assert_that(big_fraction(0, 1), is_equal(math::sum_fractions(terms_type())));
+        assert_that(big_fraction(3, 2), is_equal(math::sum_fractions(terms_type(1, big_fraction(6, 4)))));
+        assert_that(big_fraction(0, 1), is_equal(math::sum_fractions(terms_type(3, big_fraction(0, 7)))));
+        assert_that(big_fraction(3, 1), is_equal(math::sum_fractions(terms_type(6, big_fraction(1, 2)))));
+    });
+
+    describe_test("testing delayed reduction", []() {
+        // (k^2 + 1) / (k * (k + 2)): numerators and denominators with common factors
+        using big_fraction = math::fraction<math::big_integer>;
+        std::vector<big_fraction> terms;
+        for (auto k = 1; k <= 300; ++k) {
+            terms.emplace_back(k * k + 1, k * (k + 2));
+        }
+        assert_that(sequential_sum(terms), is_equal(math::sum_fractions(terms, 2)));
+
+        // biggest denominator with 64 bit and the first one with more
+        const auto max = math::big_integer(std::numeric_limits<uint64_t>::max());
+        const std::vector<big_fraction> boundary{big_fraction(2, max), big_fraction(1, 3), big_fraction(7, 85)};
+        assert_that(sequential_sum(boundary), is_equal(math::sum_fractions(boundary)));
+
+        const auto power = math::detail::decimal_limbs::to_big_integer({709551616, 446744073, 18});
+        const std::vector<big_fraction> bigger{big_fraction(1, max), big_fraction(1, power), big_fraction(5, 6)};
+        assert_that(sequential_sum(bigger), is_equal(math::sum_fractions(bigger)));
+    });
+});
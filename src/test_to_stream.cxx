@@ -21,6 +21,7 @@
 /// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <unittest/unittest.h>
+#include <iomanip>
 #include <sstream>
 
 using namespace unittest;
@@ -60,6 +61,28 @@ describe_suite("testing types::to_stream<T>", [](){
         assert_that(std::string("[2, 4, 6, 8]"), is_equal(stream.str()));
     });
 
+    describe_test("testing to_stream<T> for integers and characters", []() {
+        std::stringstream stream;
+        types::to_stream<int64_t>::dump(stream, -1234567890123LL);
+        types::to_stream<char>::dump(stream, 'x');
+        types::to_stream<unsigned char>::dump(stream, 200);
+        types::to_stream<double>::dump(stream, 1.5);
+        assert_that(std::string("-1234567890123x2001.5"), is_equal(stream.str()));
+    });
+
+    describe_test("testing to_stream<T> for integers respecting the stream format", []() {
+        std::stringstream stream;
+        stream << std::hex;
+        types::to_stream<int>::dump(stream, 255);
+        stream << std::dec << " " << std::setw(5);
+        types::to_stream<uint64_t>::dump(stream, 42);
+        stream << " " << std::showpos;
+        types::to_stream<int>::dump(stream, 7);
+        stream << std::noshowpos << " ";
+        types::to_stream<unsigned char>::dump(stream, 9);
+        assert_that(std::string("ff    42 +7 9"), is_equal(stream.str()));
+    });
+
     describe_test("testing to_stream<std::set<int>>", []() {
         const std::set<int> values = {2, 4, 6, 8};
         std::stringstream stream;